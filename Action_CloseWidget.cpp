@@ -2,15 +2,11 @@
 #include "Subsystems/WidgetSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
-void UAction_CloseWidget::ExecuteAction(AActor* ContextActor) const
+void UAction_CloseWidget::ExecuteAction(const FMissionExecutionContext& Context) const
 {
-    if (TargetWidgetTag.IsNone() || !ContextActor) return;
+    if (TargetWidgetTag.IsNone() || !Context.GameInstance) return;
 
-    UWorld* World = ContextActor->GetWorld();
-    if (!World) return;
-
-    UGameInstance* GI = World->GetGameInstance();
-    UWidgetSubsystem* WidgetSubsystem = GI ? GI->GetSubsystem<UWidgetSubsystem>() : nullptr;
+    UWidgetSubsystem* WidgetSubsystem = Context.GameInstance->GetSubsystem<UWidgetSubsystem>();
 
     if (WidgetSubsystem)
     {
@@ -14,5 +14,5 @@ public:
     UPROPERTY(EditAnywhere, Category = "Config")
     FName TargetWidgetTag;
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 };
\ No newline at end of file
@@ -4,7 +4,7 @@
 #include "Blueprint/UserWidget.h"
 #include "Subsystems/WidgetSubsystem.h" 
 
-void UAction_CreateWidget::ExecuteAction(AActor* ContextActor) const
+void UAction_CreateWidget::ExecuteAction(const FMissionExecutionContext& Context) const
 {
     // 1. Validation
     if (!WidgetConfig)
@@ -15,17 +15,14 @@ void UAction_CreateWidget::ExecuteAction(AActor* ContextActor) const
 
     // 2. Get Player Controller
     APlayerController* PC = nullptr;
-    if (APawn* Pawn = Cast<APawn>(ContextActor))
+    if (APawn* Pawn = Cast<APawn>(Context.ContextActor))
     {
         PC = Cast<APlayerController>(Pawn->GetController());
     }
     // Fallback logic
-    if (!PC && ContextActor)
+    if (!PC && Context.World)
     {
-        if (UWorld* World = ContextActor->GetWorld())
-        {
-            PC = World->GetFirstPlayerController();
-        }
+        PC = Context.World->GetFirstPlayerController();
     }
 
     if (!PC) return;
@@ -1,11 +1,9 @@
 #include "Missions/Actions/Action_DataLayer.h"
 #include "Engine/World.h"
 
-void UAction_DataLayer::ExecuteAction(AActor* ContextActor) const
+void UAction_DataLayer::ExecuteAction(const FMissionExecutionContext& Context) const
 {
-    if (!ContextActor) return;
-
-    UWorld* World = ContextActor->GetWorld();
+    UWorld* World = Context.World;
     if (!World) return;
 
     // Access the Subsystem from the WORLD (because Data Layers are a World concept)
@@ -13,4 +11,15 @@ void UAction_DataLayer::ExecuteAction(AActor* ContextActor) const
     {
         LevelState->SetDataLayerState(LayerName, TargetState);
     }
+}
+
+bool UAction_DataLayer::PollLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const
+{
+    UWorld* World = State.World.Get();
+    ULevelStateSubsystem* LevelState = World ? World->GetSubsystem<ULevelStateSubsystem>() : nullptr;
+
+    // Nothing to wait on
+    if (!LevelState) return true;
+
+    return LevelState->IsDataLayerInState(LayerName, TargetState);
 }
\ No newline at end of file
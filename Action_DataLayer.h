@@ -24,5 +24,13 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Config")
     EDataLayerRuntimeState TargetState;
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    // Hold back the following actions until the layer has reached TargetState and finished streaming.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Config")
+    bool bWaitUntilApplied = false;
+
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
+
+    virtual bool IsLatent() const override { return bWaitUntilApplied; }
+
+    virtual bool PollLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const override;
 };
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "Missions/Actions/Action_Delayed.h"
+#include "Subsystems/MissionSubsystem.h"
+#include "Missions/MissionLog.h"
+
+void UAction_Delayed::ExecuteAction(const FMissionExecutionContext& Context) const
+{
+    if (!Action) return;
+
+    // 1. Find the Subsystem through the context
+    UMissionSubsystem* MissionSys = Context.MissionSubsystem;
+
+    if (!MissionSys)
+    {
+        UE_LOG(LogPeripheryMission, Warning, TEXT("Action_Delayed: No Mission Subsystem in the context. Running %s now."), *Action->GetName());
+        Action->ExecuteAction(Context);
+        return;
+    }
+
+    // 2. Schedule
+    MissionSys->ScheduleDelayedAction(Action, Context.ContextActor, Delay);
+}
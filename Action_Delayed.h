@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Missions/Actions/MissionAction.h"
+#include "Action_Delayed.generated.h"
+
+/**
+ * Runs another action after a delay, on the Mission Subsystem's timer wheel.
+ * Pauses with the game and survives save / load.
+ */
+UCLASS(DisplayName = "Delayed")
+class INSIDETFV03_API UAction_Delayed : public UMissionAction
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = "0.0", Units = "s"))
+    float Delay = 1.f;
+
+    UPROPERTY(EditAnywhere, Instanced, Category = "Config")
+    TObjectPtr<UMissionAction> Action;
+
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
+};
@@ -2,12 +2,9 @@
 
 #include "Missions/Actions/Action_LevelPhase.h"
 
-void UAction_LevelPhase::ExecuteAction(AActor* ContextActor) const
+void UAction_LevelPhase::ExecuteAction(const FMissionExecutionContext& Context) const
 {
-    if (!ContextActor) return;
-
-    // Get the World from the Actor
-    UWorld* World = ContextActor->GetWorld();
+    UWorld* World = Context.World;
     if (!World) return;
 
     // Access the Subsystem from the WORLD
@@ -16,6 +16,6 @@ class INSIDETFV03_API UAction_LevelPhase : public UMissionAction
 public:
 
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 
 };
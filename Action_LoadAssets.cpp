@@ -0,0 +1,21 @@
+#include "Missions/Actions/Action_LoadAssets.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+void UAction_LoadAssets::BeginLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const
+{
+    TArray<FSoftObjectPath> Paths;
+    for (const TSoftObjectPtr<UObject>& Asset : Assets)
+    {
+        if (!Asset.IsNull()) Paths.Add(Asset.ToSoftObjectPath());
+    }
+    if (Paths.Num() == 0) return;
+
+    State.LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths);
+}
+
+bool UAction_LoadAssets::PollLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const
+{
+    const TSharedPtr<FStreamableHandle>& Handle = State.LoadHandle;
+    return !Handle.IsValid() || Handle->HasLoadCompleted() || Handle->WasCanceled();
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Missions/Actions/MissionAction.h"
+#include "Action_LoadAssets.generated.h"
+
+/**
+ * Async loads assets and holds back the following actions in the list until they are in memory.
+ * The assets stay loaded until the rest of the list has run.
+ */
+UCLASS(DisplayName = "Load Assets")
+class INSIDETFV03_API UAction_LoadAssets : public UMissionAction
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, Category = "Config")
+    TArray<TSoftObjectPtr<UObject>> Assets;
+
+    virtual bool IsLatent() const override { return true; }
+
+    virtual void BeginLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const override;
+
+    virtual bool PollLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const override;
+};
@@ -2,8 +2,9 @@
 #include "Kismet/GameplayStatics.h"
 #include "Components/AudioComponent.h"
 
-void UAction_PlaySound::ExecuteAction(AActor* ContextActor) const
+void UAction_PlaySound::ExecuteAction(const FMissionExecutionContext& Context) const
 {
+    AActor* ContextActor = Context.ContextActor;
     if (!ContextActor || !MetaSoundBase) return;
 
     // 1. Spawn the Sound (Fire and Forget)
@@ -19,7 +19,7 @@ class INSIDETFV03_API UAction_PlaySound : public UMissionAction
     GENERATED_BODY()
 
 public:
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 
 protected:
 
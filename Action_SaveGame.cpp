@@ -2,18 +2,17 @@
 #include "Core/PeripheryGameInstance.h"
 #include "Kismet/GameplayStatics.h"
 
-void UAction_SaveGame::ExecuteAction(AActor* ContextActor) const
+void UAction_SaveGame::ExecuteAction(const FMissionExecutionContext& Context) const
 {
     // 1. Validate Context
-    if (!ContextActor)
+    if (!Context.GameInstance)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Action_SaveGame: Failed. ContextActor is null."));
+        UE_LOG(LogTemp, Warning, TEXT("Action_SaveGame: Failed. No GameInstance in the context."));
         return;
     }
 
     // 2. Get Game Instance
-    UGameInstance* GI = ContextActor->GetGameInstance();
-    UPeripheryGameInstance* PeripheryGI = Cast<UPeripheryGameInstance>(GI);
+    UPeripheryGameInstance* PeripheryGI = Cast<UPeripheryGameInstance>(Context.GameInstance);
 
     if (!PeripheryGI)
     {
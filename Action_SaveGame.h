@@ -17,5 +17,5 @@ public:
     UPROPERTY(EditAnywhere, Category = "Config")
     FString SlotName = "AutoSave"; 
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 };
\ No newline at end of file
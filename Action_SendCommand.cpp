@@ -4,7 +4,7 @@
 
 
 
-void UAction_SendCommand::ExecuteAction(AActor* ContextActor) const
+void UAction_SendCommand::ExecuteAction(const FMissionExecutionContext& Context) const
 {
     if (!ActorTag.IsValid() || !CommandTag.IsValid()) 
     {
@@ -12,14 +12,15 @@ void UAction_SendCommand::ExecuteAction(AActor* ContextActor) const
         return;
     }
 
-    else if (auto* Registry = ContextActor->GetGameInstance()->GetSubsystem<UActorRegistrySubsystem>())
+    else if (Context.Registry)
     {
-        TArray<AActor*> Targets = Registry->GetActors(ActorTag);
+        // Cached for the frame, so a list of commands to the same tag only searches the registry once
+        TArray<AActor*> Targets = Context.GetActors(ActorTag);
 
         for (AActor* Target : Targets)
         {
             // 1. Check for Interface Implementation
-            if (Target && Target->Implements<UCommandInterface>())
+            if (IsValid(Target) && Target->Implements<UCommandInterface>())
             {
                 // 2. Execute the Interface call safely
                 ICommandInterface::Execute_ReceiveCommand(Target, CommandTag);
@@ -17,7 +17,7 @@ public:
     UPROPERTY(EditAnywhere, Category = "Config")
     FGameplayTag CommandTag;
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 	
 };
 
@@ -2,23 +2,16 @@
 #include "Subsystems/ActorRegistrySubsystem.h"
 #include "Interfaces/ConfigurableInterface.h"
 
-void UAction_SendData::ExecuteAction(AActor* ContextActor) const
+void UAction_SendData::ExecuteAction(const FMissionExecutionContext& Context) const
 {
-    if (!ContextActor)
-    {
-        return;
-    }
-
-
-    UActorRegistrySubsystem* Registry = ContextActor->GetGameInstance()->GetSubsystem<UActorRegistrySubsystem>();
-    if (!Registry)
+    if (!Context.Registry)
     {
         return;
     }
 
     // Find the target(s). Use GetActors (Plural) in case we want to update all screens at once.
     // If you only expect one, this loop just runs once.
-    TArray<AActor*> Targets = Registry->GetActors(ActorTag);
+    TArray<AActor*> Targets = Context.GetActors(ActorTag);
 
     for (AActor* Target : Targets)
     {
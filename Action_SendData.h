@@ -25,6 +25,6 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Config")
     FGameplayTag ContextTag;
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 };
 
@@ -2,14 +2,14 @@
 #include "Missions/Actions/Action_SpawnActor.h"
 #include "Subsystems/ActorRegistrySubsystem.h"
 
-void UAction_SpawnActor::ExecuteAction(AActor* ContextActor) const
+void UAction_SpawnActor::ExecuteAction(const FMissionExecutionContext& Context) const
 {
-    if (!ContextActor || !ActorClass)
+    if (!ActorClass)
     {
         return;
     }
 
-    UWorld* World = ContextActor->GetWorld();
+    UWorld* World = Context.World;
     if (!World)
     {
         return;
@@ -21,14 +21,12 @@ void UAction_SpawnActor::ExecuteAction(AActor* ContextActor) const
     // If we provided a Tag, we want to spawn relative to that actor (Anchor).
     if (SpawnAtActorTag.IsValid())
     {
-        if (auto* Registry = ContextActor->GetGameInstance()->GetSubsystem<UActorRegistrySubsystem>())
+        AActor* Anchor = Context.FindActor(SpawnAtActorTag);
+        if (IsValid(Anchor))
         {
-            if (AActor* Anchor = Registry->FindActor(SpawnAtActorTag))
-            {
-                // Compose: Apply our SpawnTransform as an offset to the Anchor's transform.
-                // Result = Offset * AnchorWorldTransform
-                FinalTransform = SpawnTransform * Anchor->GetActorTransform();
-            }
+            // Compose: Apply our SpawnTransform as an offset to the Anchor's transform.
+            // Result = Offset * AnchorWorldTransform
+            FinalTransform = SpawnTransform * Anchor->GetActorTransform();
         }
     }
 
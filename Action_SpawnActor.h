@@ -33,5 +33,5 @@ public:
     UPROPERTY(EditAnywhere, Category = "Config")
     ESpawnActorCollisionHandlingMethod CollisionMethod = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 };
\ No newline at end of file
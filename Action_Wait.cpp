@@ -0,0 +1,10 @@
+#include "Missions/Actions/Action_Wait.h"
+#include "Engine/World.h"
+
+bool UAction_Wait::PollLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const
+{
+    const UWorld* World = State.World.Get();
+    if (!World) return true;
+
+    return World->GetTimeSeconds() - State.StartTime >= Duration;
+}
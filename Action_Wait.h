@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Missions/Actions/MissionAction.h"
+#include "Action_Wait.generated.h"
+
+/**
+ * Holds back the following actions in the list for a while (game time, pauses with the game).
+ * Use "Delayed" instead to run a single action later without blocking the rest.
+ */
+UCLASS(DisplayName = "Wait")
+class INSIDETFV03_API UAction_Wait : public UMissionAction
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = "0.0", Units = "s"))
+    float Duration = 1.f;
+
+    virtual bool IsLatent() const override { return true; }
+
+    virtual bool PollLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const override;
+
+    virtual float GetLatentTimeout() const override { return 0.f; }
+};
@@ -1,11 +1,11 @@
 
 #include "Missions/Actions/Action_Widget.h"
 
-void UAction_Widget::ExecuteAction(AActor* ContextActor) const 
+void UAction_Widget::ExecuteAction(const FMissionExecutionContext& Context) const 
 {
-    if (!ContextActor) return;
+    if (!Context.GameInstance) return;
 
-    if (UWidgetSubsystem* WidgetSys = ContextActor->GetGameInstance()->GetSubsystem<UWidgetSubsystem>())
+    if (UWidgetSubsystem* WidgetSys = Context.GameInstance->GetSubsystem<UWidgetSubsystem>())
     {
     
     }
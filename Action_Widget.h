@@ -17,6 +17,6 @@ public:
     UPROPERTY(EditAnywhere, Category = "Config")
     FGameplayTag WidgetTag;
 
-    virtual void ExecuteAction(AActor* ContextActor) const override;
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const override;
 
 };
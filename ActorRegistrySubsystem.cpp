@@ -1,7 +1,20 @@
 #include "Subsystems/ActorRegistrySubsystem.h"
 #include "Interfaces/ActorRegistryInterface.h"
 #include "Misc/OutputDeviceNull.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
 
+void UActorRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UActorRegistrySubsystem::HandleLevelRemoved);
+}
+
+void UActorRegistrySubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	Super::Deinitialize();
+}
 
 // ---------- Actor registry ----------
 void UActorRegistrySubsystem::RegisterActorForTag(AActor* Actor, FGameplayTag Tag)
@@ -23,16 +36,21 @@ void UActorRegistrySubsystem::RegisterActorForTag(AActor* Actor, FGameplayTag Ta
 	}
 
 	// Registering actor
-	TSet<TWeakObjectPtr<AActor>>& SetRef = TagToActors.FindOrAdd(Tag);
-
-	const int32 Before = SetRef.Num();
-	SetRef.Add(TWeakObjectPtr<AActor>(Actor)); // safe to call repeatedly
-	const bool bAdded = (SetRef.Num() > Before);
+	const int32 Slot = AcquireSlot(Actor);
+	const bool bAdded = TagToActors.FindOrAdd(Tag).Add(Slot); // safe to call repeatedly
 
 	if (bAdded)
 	{
+		Version++;
+		Slots[Slot].Tags.Add(Tag);
+		UpdateHierarchyIndex(Slot, Tag, true);
 		UE_LOG(LogTemp, Log, TEXT("ActorRegistrySubsystem: Registered Actor '%s' under Tag '%s'"),
 			*GetNameSafe(Actor), *Tag.ToString());
+
+		if (!SpatialTagRoots.IsEmpty() && Tag.MatchesAny(SpatialTagRoots))
+		{
+			RegisterSpatialActor(Actor);
+		}
 	}
 	else
 	{
@@ -43,20 +61,28 @@ void UActorRegistrySubsystem::RegisterActorForTag(AActor* Actor, FGameplayTag Ta
 
 void UActorRegistrySubsystem::UnregisterActorForTag(AActor* Actor, FGameplayTag Tag)
 {
-	if (!IsValid(Actor) || !Tag.IsValid()) return;
+	if (!Actor || !Tag.IsValid()) return;
 
-	if (TSet<TWeakObjectPtr<AActor>>* SetPtr = TagToActors.Find(Tag))
+	const int32* SlotPtr = ActorToSlot.Find(Actor);
+	FTagMembers* Members = TagToActors.Find(Tag);
+	if (!SlotPtr || !Members) return;
+
+	const int32 Slot = *SlotPtr;
+	if (!Members->Remove(Slot)) return;
+
+	Version++;
+	UpdateHierarchyIndex(Slot, Tag, false);
+	if (Members->Num() == 0)
 	{
-		SetPtr->Remove(TWeakObjectPtr<AActor>(Actor));
-		for (auto It = SetPtr->CreateIterator(); It; ++It)
-		{
-			AActor* Ptr = It->Get();
-			if (!IsValid(Ptr)) It.RemoveCurrent();
-		}
-		if (SetPtr->Num() == 0)
-		{
-			TagToActors.Remove(Tag);
-		}
+		TagToActors.Remove(Tag);
+	}
+
+	// Last tag gone: the actor leaves the registry
+	TArray<FGameplayTag, TInlineAllocator<4>>& SlotTags = Slots[Slot].Tags;
+	SlotTags.RemoveSingleSwap(Tag);
+	if (SlotTags.IsEmpty())
+	{
+		ReleaseSlot(Slot);
 	}
 }
 
@@ -64,21 +90,35 @@ void UActorRegistrySubsystem::RemoveActorFromAllTags(AActor* Actor)
 {
     if (!Actor) return;
 
-    // Iterate over the entire map (Values are Sets of Actors)
-    for (auto It = TagToActors.CreateIterator(); It; ++It)
+    if (const int32* Slot = ActorToSlot.Find(Actor))
+    {
+        RemoveSlot(*Slot);
+    }
+}
+
+void UActorRegistrySubsystem::RemoveActorsInLevel(const ULevel* Level, const UWorld* World)
+{
+    if (!Level && !World) return;
+
+    // The slot array is dense, so this is one pass over registered actors, not over tags
+    int32 NumRemoved = 0;
+    for (int32 Slot = 0; Slot < Slots.Num(); Slot++)
     {
-        TSet<TWeakObjectPtr<AActor>>& ActorSet = It.Value();
-        
-        // Remove the actor if present
-        if (ActorSet.Remove(Actor) > 0)
+        const AActor* Actor = Slots[Slot].Actor;
+        if (!Actor) continue;
+
+        const bool bInScope = Level ? Actor->GetLevel() == Level : Actor->GetWorld() == World;
+        if (bInScope)
         {
-            // If the set becomes empty, we can remove the Tag entry entirely
-            if (ActorSet.IsEmpty())
-            {
-                It.RemoveCurrent();
-            }
+            RemoveSlot(Slot);
+            NumRemoved++;
         }
     }
+
+    if (NumRemoved > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("ActorRegistrySubsystem: Cleared %d actors from %s"), NumRemoved, Level ? *GetNameSafe(Level->GetOuter()) : *GetNameSafe(World));
+    }
 }
 
 // ---------- Queries ----------
@@ -86,14 +126,12 @@ TArray<AActor*> UActorRegistrySubsystem::GetActorsForTag(FGameplayTag Tag) const
 {
     TArray<AActor*> Results;
 
-    if (const TSet<TWeakObjectPtr<AActor>>* FoundSet = TagToActors.Find(Tag))
+    if (const FTagMembers* Found = TagToActors.Find(Tag))
     {
-        for (const TWeakObjectPtr<AActor>& WeakActor : *FoundSet)
+        Results.Reserve(Found->Num());
+        for (const int32 Slot : Found->Slots)
         {
-            if (AActor* LiveActor = WeakActor.Get())
-            {
-                Results.Add(LiveActor);
-            }
+            Results.Add(Slots[Slot].Actor);
         }
     }
     return Results;
@@ -101,28 +139,104 @@ TArray<AActor*> UActorRegistrySubsystem::GetActorsForTag(FGameplayTag Tag) const
 
 TArray<AActor*> UActorRegistrySubsystem::GetActorsWithIntersection(FGameplayTag TagA, FGameplayTag TagB)
 {
-    // 1. Get Set A (using hierarchy search)
-    TArray<AActor*> ListA = GetActors(TagA);
-    if (ListA.IsEmpty()) return TArray<AActor*>();
+    TArray<AActor*> Intersection;
+    QueryActors(FActorTagQuery().All(TagA).All(TagB), Intersection);
+    return Intersection;
+}
 
-    // 2. Get Set B (using hierarchy search)
-    TArray<AActor*> ListB = GetActors(TagB);
-    if (ListB.IsEmpty()) return TArray<AActor*>();
+bool UActorRegistrySubsystem::ResolveQuery(const FActorTagQuery& Query, FResolvedTagQuery& OutResolved) const
+{
+    // A missing AllOf list means nothing can match
+    for (const FGameplayTag& Tag : Query.AllOf)
+    {
+        const FTagMembers* Set = HierarchyToActors.Find(Tag);
+        if (!Set) return false;
+        OutResolved.AllSets.Add(Set);
+    }
 
-    // 3. Convert List B to Set for O(1) lookup speed
-    TSet<AActor*> SetB(ListB);
+    for (const FGameplayTag& Tag : Query.AnyOf)
+    {
+        if (const FTagMembers* Set = HierarchyToActors.Find(Tag)) OutResolved.AnySets.Add(Set);
+    }
+    if (!Query.AnyOf.IsEmpty() && OutResolved.AnySets.IsEmpty()) return false;
 
-    // 4. Filter A
-    TArray<AActor*> Intersection;
-    for (AActor* Actor : ListA)
+    for (const FGameplayTag& Tag : Query.NoneOf)
     {
-        if (SetB.Contains(Actor))
+        if (const FTagMembers* Set = HierarchyToActors.Find(Tag)) OutResolved.NoneSets.Add(Set);
+    }
+    return true;
+}
+
+bool UActorRegistrySubsystem::FResolvedTagQuery::Matches(int32 Slot, const FTagMembers* Driver, bool bCheckAny) const
+{
+    for (const FTagMembers* Set : AllSets)
+    {
+        if (Set != Driver && !Set->Contains(Slot)) return false;
+    }
+    if (bCheckAny && !AnySets.IsEmpty() && !AnySets.ContainsByPredicate([Slot](const FTagMembers* Set) { return Set->Contains(Slot); }))
+    {
+        return false;
+    }
+    for (const FTagMembers* Set : NoneSets)
+    {
+        if (Set->Contains(Slot)) return false;
+    }
+    return true;
+}
+
+void UActorRegistrySubsystem::ForEachActor(const FActorTagQuery& Query, TFunctionRef<bool(AActor*)> Visitor) const
+{
+    // 1. Resolve the tags to index lists
+    FResolvedTagQuery Resolved;
+    if (!ResolveQuery(Query, Resolved)) return;
+
+    // 2. Walk the smallest AllOf list and probe the rest
+    if (!Resolved.AllSets.IsEmpty())
+    {
+        const FTagMembers* Driver = Resolved.AllSets[0];
+        for (const FTagMembers* Set : Resolved.AllSets)
+        {
+            if (Set->Num() < Driver->Num()) Driver = Set;
+        }
+
+        for (const int32 Slot : Driver->Slots)
         {
-            Intersection.Add(Actor);
+            if (Resolved.Matches(Slot, Driver) && !Visitor(Slots[Slot].Actor)) return;
         }
+        return;
     }
 
-    return Intersection;
+    // 3. Only NoneOf (or an empty query): every registered actor is a candidate
+    if (Resolved.AnySets.IsEmpty())
+    {
+        for (int32 Slot = 0; Slot < Slots.Num(); Slot++)
+        {
+            if (Slots[Slot].Actor && Resolved.Matches(Slot) && !Visitor(Slots[Slot].Actor)) return;
+        }
+        return;
+    }
+
+    // 4. Only AnyOf: walk each list, skipping actors an earlier list already produced
+    const auto& AnySets = Resolved.AnySets;
+    for (int32 i = 0; i < AnySets.Num(); i++)
+    {
+        for (const int32 Slot : AnySets[i]->Slots)
+        {
+            bool bSeen = false;
+            for (int32 j = 0; j < i && !bSeen; j++)
+            {
+                bSeen = AnySets[j]->Contains(Slot);
+            }
+            if (!bSeen && Resolved.Matches(Slot, nullptr, false) && !Visitor(Slots[Slot].Actor)) return;
+        }
+    }
+}
+
+AActor* UActorRegistrySubsystem::FindFirstActor(const FActorTagQuery& Query) const
+{
+    AActor* First = nullptr;
+    ForEachActor(Query, [&First](AActor* Actor) { First = Actor; return false; });
+    return First;
 }
 
 TArray<AActor*> UActorRegistrySubsystem::GetActors(FGameplayTag Tag) const
@@ -130,61 +244,445 @@ TArray<AActor*> UActorRegistrySubsystem::GetActors(FGameplayTag Tag) const
     TArray<AActor*> Results;
     if (!Tag.IsValid()) return Results;
 
-    // Iterate over ALL registered tags to find children
-    for (const auto& Pair : TagToActors)
+    // The index already holds every actor registered under Tag or one of its children, once
+    const FTagMembers* Found = HierarchyToActors.Find(Tag);
+    if (!Found) return Results;
+
+    Results.Reserve(Found->Num());
+    for (const int32 Slot : Found->Slots)
+    {
+        Results.Add(Slots[Slot].Actor);
+    }
+    return Results;
+}
+
+AActor* UActorRegistrySubsystem::FindActor(FGameplayTag Tag) const
+{
+    const FTagMembers* Found = TagToActors.Find(Tag);
+    return Found && Found->Num() > 0 ? Slots[Found->Slots[0]].Actor : nullptr;
+}
+
+FActorRegistryHandle UActorRegistrySubsystem::GetActorHandle(const AActor* Actor) const
+{
+    FActorRegistryHandle Handle;
+    if (const int32* Slot = ActorToSlot.Find(Actor))
+    {
+        Handle.Index = *Slot;
+        Handle.Generation = Slots[*Slot].Generation;
+    }
+    return Handle;
+}
+
+AActor* UActorRegistrySubsystem::ResolveActorHandle(FActorRegistryHandle Handle) const
+{
+    if (!Slots.IsValidIndex(Handle.Index)) return nullptr;
+
+    const FActorSlot& Slot = Slots[Handle.Index];
+    return Slot.Generation == Handle.Generation ? Slot.Actor : nullptr;
+}
+
+// ---------- Helper ----------
+bool UActorRegistrySubsystem::FTagMembers::Add(int32 Slot)
+{
+	if (const int32* Position = Positions.Find(Slot))
+	{
+		Counts[*Position]++;
+		return false;
+	}
+
+	Positions.Add(Slot, Slots.Add(Slot));
+	Counts.Add(1);
+	return true;
+}
+
+bool UActorRegistrySubsystem::FTagMembers::Remove(int32 Slot)
+{
+	const int32* PositionPtr = Positions.Find(Slot);
+	if (!PositionPtr) return false;
+
+	const int32 Position = *PositionPtr;
+	if (--Counts[Position] > 0) return false;
+
+	// Swap the last entry into the hole to keep the list dense
+	Positions.Remove(Slot);
+	Slots.RemoveAtSwap(Position);
+	Counts.RemoveAtSwap(Position);
+	if (Position < Slots.Num())
+	{
+		Positions[Slots[Position]] = Position;
+	}
+	return true;
+}
+
+int32 UActorRegistrySubsystem::AcquireSlot(AActor* Actor)
+{
+	if (const int32* Existing = ActorToSlot.Find(Actor))
+	{
+		return *Existing;
+	}
+
+	const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Slots.AddDefaulted();
+	Slots[Slot].Actor = Actor;
+	ActorToSlot.Add(Actor, Slot);
+
+	// Destroyed or streamed out actors leave the registry on their own
+	Actor->OnEndPlay.AddUniqueDynamic(this, &UActorRegistrySubsystem::HandleActorEndPlay);
+	Actor->OnDestroyed.AddUniqueDynamic(this, &UActorRegistrySubsystem::HandleActorDestroyed);
+	return Slot;
+}
+
+void UActorRegistrySubsystem::ReleaseSlot(int32 Slot)
+{
+	RemoveSpatial(Slot);
+
+	FActorSlot& Entry = Slots[Slot];
+	if (AActor* Actor = Entry.Actor)
+	{
+		Actor->OnEndPlay.RemoveDynamic(this, &UActorRegistrySubsystem::HandleActorEndPlay);
+		Actor->OnDestroyed.RemoveDynamic(this, &UActorRegistrySubsystem::HandleActorDestroyed);
+		ActorToSlot.Remove(Actor);
+	}
+
+	// Outstanding handles to this slot go stale
+	Entry.Actor = nullptr;
+	Entry.Tags.Reset();
+	Entry.Generation++;
+	FreeSlots.Add(Slot);
+}
+
+void UActorRegistrySubsystem::RemoveSlot(int32 Slot)
+{
+	// Only the actor's own tags are touched, however many tags the registry holds
+	for (const FGameplayTag& Tag : Slots[Slot].Tags)
+	{
+		FTagMembers* Members = TagToActors.Find(Tag);
+		if (!Members || !Members->Remove(Slot)) continue;
+
+		Version++;
+		UpdateHierarchyIndex(Slot, Tag, false);
+		if (Members->Num() == 0)
+		{
+			TagToActors.Remove(Tag);
+		}
+	}
+
+	ReleaseSlot(Slot);
+}
+
+void UActorRegistrySubsystem::HandleLevelRemoved(ULevel* Level, UWorld* World)
+{
+	// Streamed-out actors normally leave through EndPlay already; this catches anything that didn't
+	RemoveActorsInLevel(Level, World);
+}
+
+void UActorRegistrySubsystem::HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	RemoveActorFromAllTags(Actor);
+}
+
+void UActorRegistrySubsystem::HandleActorDestroyed(AActor* DestroyedActor)
+{
+	RemoveActorFromAllTags(DestroyedActor);
+}
+
+void UActorRegistrySubsystem::UpdateHierarchyIndex(int32 Slot, FGameplayTag Tag, bool bAdd)
+{
+	// Walk up: A.B.C -> A.B -> A
+	for (FGameplayTag Current = Tag; Current.IsValid(); Current = Current.RequestDirectParent())
+	{
+		if (bAdd)
+		{
+			HierarchyToActors.FindOrAdd(Current).Add(Slot);
+			continue;
+		}
+
+		FTagMembers* Members = HierarchyToActors.Find(Current);
+		if (Members && Members->Remove(Slot) && Members->Num() == 0)
+		{
+			HierarchyToActors.Remove(Current);
+		}
+	}
+}
+
+// ---------- Spatial ----------
+namespace
+{
+    // 10 m cells: a room or a stretch of street per cell
+    constexpr float SpatialCellSize = 1000.f;
+
+    FIntVector SpatialCellOf(const FVector& Location)
+    {
+        return FIntVector(
+            FMath::FloorToInt32(Location.X / SpatialCellSize),
+            FMath::FloorToInt32(Location.Y / SpatialCellSize),
+            FMath::FloorToInt32(Location.Z / SpatialCellSize));
+    }
+
+    FIntVector CellMin(const FIntVector& A, const FIntVector& B)
+    {
+        return FIntVector(FMath::Min(A.X, B.X), FMath::Min(A.Y, B.Y), FMath::Min(A.Z, B.Z));
+    }
+
+    FIntVector CellMax(const FIntVector& A, const FIntVector& B)
     {
-        const FGameplayTag& RegisteredTag = Pair.Key;
+        return FIntVector(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y), FMath::Max(A.Z, B.Z));
+    }
+}
+
+void UActorRegistrySubsystem::RegisterSpatialActor(AActor* Actor)
+{
+	const int32* SlotPtr = Actor ? ActorToSlot.Find(Actor) : nullptr;
+	if (!SlotPtr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ActorRegistrySubsystem::RegisterSpatialActor -> '%s' has no registered tag, register it first"),
+			*GetNameSafe(Actor));
+		return;
+	}
+
+	const int32 Slot = *SlotPtr;
+	FActorSlot& Entry = Slots[Slot];
+	if (Entry.bSpatial) return;
+
+	// 1. File it under its current cell
+	Entry.bSpatial = true;
+	Entry.Location = Actor->GetActorLocation();
+	Entry.Cell = SpatialCellOf(Entry.Location);
+	SpatialCells.FindOrAdd(Entry.Cell).Add(Slot);
+
+	SpatialCellMin = NumSpatial == 0 ? Entry.Cell : CellMin(SpatialCellMin, Entry.Cell);
+	SpatialCellMax = NumSpatial == 0 ? Entry.Cell : CellMax(SpatialCellMax, Entry.Cell);
+	NumSpatial++;
+
+	// 2. Only movable actors are followed; static and stationary ones keep their cell
+	USceneComponent* Root = Actor->GetRootComponent();
+	if (Root && Root->Mobility == EComponentMobility::Movable)
+	{
+		Entry.SpatialRoot = Root;
+		Entry.TransformHandle = Root->TransformUpdated.AddUObject(this, &UActorRegistrySubsystem::HandleSpatialTransformUpdated, Slot);
+	}
+}
+
+void UActorRegistrySubsystem::UnregisterSpatialActor(AActor* Actor)
+{
+	if (const int32* Slot = Actor ? ActorToSlot.Find(Actor) : nullptr)
+	{
+		RemoveSpatial(*Slot);
+	}
+}
 
-        // MatchesTag returns true for Exact Matches AND Child Matches
-        if (RegisteredTag.MatchesTag(Tag))
+void UActorRegistrySubsystem::AddSpatialTagRoot(FGameplayTag Root)
+{
+	if (!Root.IsValid() || SpatialTagRoots.HasTagExact(Root)) return;
+	SpatialTagRoots.AddTag(Root);
+
+	// Catch up on actors that registered before the root was added
+	if (const FTagMembers* Members = HierarchyToActors.Find(Root))
+	{
+		for (const int32 Slot : Members->Slots)
+		{
+			RegisterSpatialActor(Slots[Slot].Actor);
+		}
+	}
+}
+
+void UActorRegistrySubsystem::RemoveSpatial(int32 Slot)
+{
+	FActorSlot& Entry = Slots[Slot];
+	if (!Entry.bSpatial) return;
+
+	if (USceneComponent* Root = Entry.SpatialRoot.Get())
+	{
+		Root->TransformUpdated.Remove(Entry.TransformHandle);
+	}
+	Entry.SpatialRoot.Reset();
+	Entry.TransformHandle.Reset();
+
+	if (TArray<int32>* Cell = SpatialCells.Find(Entry.Cell))
+	{
+		Cell->RemoveSingleSwap(Slot);
+		if (Cell->IsEmpty()) SpatialCells.Remove(Entry.Cell);
+	}
+	Entry.bSpatial = false;
+	NumSpatial--;
+}
+
+void UActorRegistrySubsystem::HandleSpatialTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 Slot)
+{
+	FActorSlot& Entry = Slots[Slot];
+	Entry.Location = Component->GetComponentLocation();
+
+	// Most moves stay inside the cell
+	const FIntVector NewCell = SpatialCellOf(Entry.Location);
+	if (NewCell == Entry.Cell) return;
+
+	if (TArray<int32>* OldCell = SpatialCells.Find(Entry.Cell))
+	{
+		OldCell->RemoveSingleSwap(Slot);
+		if (OldCell->IsEmpty()) SpatialCells.Remove(Entry.Cell);
+	}
+	SpatialCells.FindOrAdd(NewCell).Add(Slot);
+	SpatialCellMin = CellMin(SpatialCellMin, NewCell);
+	SpatialCellMax = CellMax(SpatialCellMax, NewCell);
+	Entry.Cell = NewCell;
+}
+
+void UActorRegistrySubsystem::ForEachSpatialSlot(const FIntVector& MinCell, const FIntVector& MaxCell, TFunctionRef<bool(int32)> Visitor) const
+{
+    // Clamp to occupied cells so huge queries don't walk empty space
+    const FIntVector Lo = CellMax(MinCell, SpatialCellMin);
+    const FIntVector Hi = CellMin(MaxCell, SpatialCellMax);
+
+    for (int32 X = Lo.X; X <= Hi.X; X++)
+    {
+        for (int32 Y = Lo.Y; Y <= Hi.Y; Y++)
         {
-            const TSet<TWeakObjectPtr<AActor>>& ActorSet = Pair.Value;
-            
-            for (const TWeakObjectPtr<AActor>& WeakActor : ActorSet)
+            for (int32 Z = Lo.Z; Z <= Hi.Z; Z++)
             {
-                if (AActor* LiveActor = WeakActor.Get())
+                const TArray<int32>* Cell = SpatialCells.Find(FIntVector(X, Y, Z));
+                if (!Cell) continue;
+
+                for (const int32 Slot : *Cell)
                 {
-                    Results.AddUnique(LiveActor);
+                    if (!Visitor(Slot)) return;
                 }
             }
         }
     }
-    return Results;
 }
 
-AActor* UActorRegistrySubsystem::FindActor(FGameplayTag Tag) const
+void UActorRegistrySubsystem::ForEachActorInRadius(const FActorTagQuery& Query, const FVector& Center, float Radius, TFunctionRef<bool(AActor*)> Visitor) const
 {
-    if (const TSet<TWeakObjectPtr<AActor>>* FoundSet = TagToActors.Find(Tag))
+    FResolvedTagQuery Resolved;
+    if (NumSpatial == 0 || Radius < 0.f || !ResolveQuery(Query, Resolved)) return;
+
+    const double RadiusSq = FMath::Square((double)Radius);
+    ForEachSpatialSlot(SpatialCellOf(Center - FVector(Radius)), SpatialCellOf(Center + FVector(Radius)), [&](int32 Slot)
     {
-        for (const TWeakObjectPtr<AActor>& WeakActor : *FoundSet)
+        const FActorSlot& Entry = Slots[Slot];
+        if (FVector::DistSquared(Entry.Location, Center) > RadiusSq || !Resolved.Matches(Slot)) return true;
+        return Visitor(Entry.Actor);
+    });
+}
+
+void UActorRegistrySubsystem::ForEachActorInBox(const FActorTagQuery& Query, const FBox& Box, TFunctionRef<bool(AActor*)> Visitor) const
+{
+    FResolvedTagQuery Resolved;
+    if (NumSpatial == 0 || !Box.IsValid || !ResolveQuery(Query, Resolved)) return;
+
+    ForEachSpatialSlot(SpatialCellOf(Box.Min), SpatialCellOf(Box.Max), [&](int32 Slot)
+    {
+        const FActorSlot& Entry = Slots[Slot];
+        if (!Box.IsInsideOrOn(Entry.Location) || !Resolved.Matches(Slot)) return true;
+        return Visitor(Entry.Actor);
+    });
+}
+
+void UActorRegistrySubsystem::CollectNearestSlots(const FActorTagQuery& Query, const FVector& Location, int32 K, float MaxDistance, TArray<int32, TInlineAllocator<16>>& OutSlots) const
+{
+    FResolvedTagQuery Resolved;
+    if (NumSpatial == 0 || K <= 0 || !ResolveQuery(Query, Resolved)) return;
+
+    struct FHit
+    {
+        double DistSq;
+        int32 Slot;
+    };
+    TArray<FHit, TInlineAllocator<16>> Best; // Sorted, nearest first
+
+    const double MaxDistSq = MaxDistance > 0.f ? FMath::Square((double)MaxDistance) : MAX_dbl;
+    const FIntVector Center = SpatialCellOf(Location);
+
+    auto Consider = [&](int32 Slot, const FTagMembers* Driver)
+    {
+        const double DistSq = FVector::DistSquared(Slots[Slot].Location, Location);
+        if (DistSq > MaxDistSq) return;
+        if (Best.Num() == K && DistSq >= Best.Last().DistSq) return;
+        if (!Resolved.Matches(Slot, Driver)) return;
+
+        int32 Insert = Best.Num();
+        while (Insert > 0 && Best[Insert - 1].DistSq > DistSq) Insert--;
+        Best.Insert(FHit{ DistSq, Slot }, Insert);
+        if (Best.Num() > K) Best.Pop();
+    };
+
+    // 1. Cells worth searching: the occupied bounds, cut down to MaxDistance around the center
+    FIntVector Lo = SpatialCellMin;
+    FIntVector Hi = SpatialCellMax;
+    if (MaxDistance > 0.f)
+    {
+        const int32 Reach = FMath::CeilToInt(MaxDistance / SpatialCellSize);
+        Lo = CellMax(Lo, Center - FIntVector(Reach));
+        Hi = CellMin(Hi, Center + FIntVector(Reach));
+    }
+    if (Lo.X > Hi.X || Lo.Y > Hi.Y || Lo.Z > Hi.Z) return;
+
+    // 2. A small AllOf list (a handful of cameras) is cheaper to scan than the cells around it
+    const FTagMembers* Driver = nullptr;
+    for (const FTagMembers* Set : Resolved.AllSets)
+    {
+        if (!Driver || Set->Num() < Driver->Num()) Driver = Set;
+    }
+    const int64 NumCells = int64(Hi.X - Lo.X + 1) * int64(Hi.Y - Lo.Y + 1) * int64(Hi.Z - Lo.Z + 1);
+    if (Driver && Driver->Num() < NumCells)
+    {
+        for (const int32 Slot : Driver->Slots)
+        {
+            if (Slots[Slot].bSpatial) Consider(Slot, Driver);
+        }
+    }
+    else
+    {
+        // 3. Grow shells of cells around the center, each clamped to the searchable bounds.
+        // Everything beyond ring R is at least R cells away.
+        const int32 MaxRing = FMath::Max3(
+            FMath::Max(Center.X - Lo.X, Hi.X - Center.X),
+            FMath::Max(Center.Y - Lo.Y, Hi.Y - Center.Y),
+            FMath::Max(Center.Z - Lo.Z, Hi.Z - Center.Z));
+
+        auto VisitCell = [&](int32 X, int32 Y, int32 Z)
+        {
+            if (const TArray<int32>* Cell = SpatialCells.Find(FIntVector(X, Y, Z)))
+            {
+                for (const int32 Slot : *Cell) Consider(Slot, nullptr);
+            }
+        };
+
+        for (int32 Ring = 0; Ring <= MaxRing; Ring++)
         {
-            if (AActor* LiveActor = WeakActor.Get())
+            const int32 X0 = FMath::Max(Center.X - Ring, Lo.X), X1 = FMath::Min(Center.X + Ring, Hi.X);
+            const int32 Y0 = FMath::Max(Center.Y - Ring, Lo.Y), Y1 = FMath::Min(Center.Y + Ring, Hi.Y);
+            const int32 Z0 = FMath::Max(Center.Z - Ring, Lo.Z), Z1 = FMath::Min(Center.Z + Ring, Hi.Z);
+
+            for (int32 X = X0; X <= X1; X++)
             {
-                return LiveActor; // Return the first valid one immediately
+                for (int32 Y = Y0; Y <= Y1; Y++)
+                {
+                    // On the shell's X/Y sides every Z is new, inside it only the two Z faces
+                    if (FMath::Abs(X - Center.X) == Ring || FMath::Abs(Y - Center.Y) == Ring)
+                    {
+                        for (int32 Z = Z0; Z <= Z1; Z++) VisitCell(X, Y, Z);
+                        continue;
+                    }
+                    if (Center.Z - Ring >= Lo.Z) VisitCell(X, Y, Center.Z - Ring);
+                    if (Center.Z + Ring <= Hi.Z) VisitCell(X, Y, Center.Z + Ring);
+                }
             }
+
+            if (Best.Num() == K && Best.Last().DistSq <= FMath::Square((double)Ring * SpatialCellSize)) break;
         }
     }
-    return nullptr;
+
+    for (const FHit& Hit : Best)
+    {
+        OutSlots.Add(Hit.Slot);
+    }
 }
 
-// ---------- Helper ----------
-void UActorRegistrySubsystem::PruneTag(FGameplayTag Tag)
+AActor* UActorRegistrySubsystem::FindNearestActor(const FActorTagQuery& Query, const FVector& Location, float MaxDistance) const
 {
-	if (TSet<TWeakObjectPtr<AActor>>* SetPtr = TagToActors.Find(Tag))
-	{
-		for (auto It = SetPtr->CreateIterator(); It; ++It)
-		{
-			AActor* Ptr = It->Get();
-			if (!IsValid(Ptr))
-			{
-				It.RemoveCurrent();
-			}
-		}
-		if (SetPtr->Num() == 0)
-		{
-			TagToActors.Remove(Tag);
-		}
-	}
+    TArray<AActor*, TInlineAllocator<1>> Nearest;
+    FindNearestActors(Query, Location, 1, Nearest, MaxDistance);
+    return Nearest.Num() > 0 ? Nearest[0] : nullptr;
 }
 
 // ---------- Save System ----------
@@ -197,13 +695,18 @@ void UActorRegistrySubsystem::RegisterSaveableActor(AActor* Actor, FGuid ActorGu
 
     // Add or Update the entry
     GuidToActorMap.Add(ActorGuid, Actor);
+    ActorToGuidMap.Add(Actor, ActorGuid);
 }
 
 void UActorRegistrySubsystem::UnregisterSaveableActor(FGuid ActorGuid)
 {
     if (ActorGuid.IsValid())
     {
-        GuidToActorMap.Remove(ActorGuid);
+        TWeakObjectPtr<AActor> Actor;
+        if (GuidToActorMap.RemoveAndCopyValue(ActorGuid, Actor))
+        {
+            ActorToGuidMap.Remove(Actor);
+        }
     }
 }
 
@@ -216,6 +719,15 @@ AActor* UActorRegistrySubsystem::GetActorByGuid(FGuid ActorGuid) const
     return nullptr;
 }
 
+FGuid UActorRegistrySubsystem::GetGuidForActor(const AActor* Actor) const
+{
+    if (const FGuid* FoundGuid = ActorToGuidMap.Find(Actor))
+    {
+        return *FoundGuid;
+    }
+    return FGuid();
+}
+
 TArray<AActor*> UActorRegistrySubsystem::GetAllSaveableActors() const
 {
     TArray<AActor*> ValidActors;
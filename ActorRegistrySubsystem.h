@@ -4,10 +4,39 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
 #include "Subsystems/LevelStateSubsystem.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Templates/Function.h"
+#include "UObject/ObjectKey.h"
 #include "ActorRegistrySubsystem.generated.h"
 
+/**
+ * Tag expression for registry queries. Tags match hierarchically, like GetActors.
+ * An actor matches if it has every AllOf tag, at least one AnyOf tag (when there are any) and no NoneOf tag.
+ * e.g. FActorTagQuery().All(ConsumerTag).All(RoomTag).None(BrokenTag)
+ */
+struct FActorTagQuery
+{
+	TArray<FGameplayTag, TInlineAllocator<4>> AllOf;
+	TArray<FGameplayTag, TInlineAllocator<4>> AnyOf;
+	TArray<FGameplayTag, TInlineAllocator<2>> NoneOf;
+
+	FActorTagQuery& All(FGameplayTag Tag) { AllOf.Add(Tag); return *this; }
+	FActorTagQuery& Any(FGameplayTag Tag) { AnyOf.Add(Tag); return *this; }
+	FActorTagQuery& None(FGameplayTag Tag) { NoneOf.Add(Tag); return *this; }
+};
+
+/** Refers to a registered actor. Goes stale once the actor leaves the registry, even if its slot is reused. */
+struct FActorRegistryHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	bool operator==(const FActorRegistryHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+};
+
 /**
  * 
  */
@@ -18,6 +47,9 @@ class INSIDETFV03_API UActorRegistrySubsystem : public UGameInstanceSubsystem
 
 public:
 
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
 	// --------- Actor Registry ----------
 	UFUNCTION(BlueprintCallable, Category="Registry|Actors")
 	void RegisterActorForTag(AActor* Actor, FGameplayTag Tag);
@@ -29,6 +61,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Registry|Actors")
     void RemoveActorFromAllTags(AActor* Actor);
 
+	// Removes every registered actor that lives in Level, or in World when Level is null. Runs when a level streams out.
+	void RemoveActorsInLevel(const ULevel* Level, const UWorld* World = nullptr);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Registry|Data")
 	TArray<AActor*> GetActorsForTag(FGameplayTag Tag) const;
 
@@ -40,6 +75,62 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Registry|Data")
     AActor* FindActor(FGameplayTag Tag) const;
+
+	// Calls Visitor for every live actor matching Query, without allocating. Return false from Visitor to stop.
+	// A query with neither AllOf nor AnyOf tags walks every registered actor, like the spatial queries.
+	// Visitor must not register or unregister actors; collect with QueryActors first if it might.
+	void ForEachActor(const FActorTagQuery& Query, TFunctionRef<bool(AActor*)> Visitor) const;
+
+	// Appends the matching actors. Pass an array with a TInlineAllocator to stay off the heap.
+	template<typename AllocatorType>
+	int32 QueryActors(const FActorTagQuery& Query, TArray<AActor*, AllocatorType>& OutActors) const
+	{
+		const int32 Before = OutActors.Num();
+		ForEachActor(Query, [&OutActors](AActor* Actor) { OutActors.Add(Actor); return true; });
+		return OutActors.Num() - Before;
+	}
+
+	// First actor matching Query, or null
+	AActor* FindFirstActor(const FActorTagQuery& Query) const;
+
+	// Changes whenever a tag registration is added or removed. Lets callers cache query results.
+	uint32 GetVersion() const { return Version; }
+
+	// Handle for an actor registered under at least one tag, unset otherwise
+	FActorRegistryHandle GetActorHandle(const AActor* Actor) const;
+
+	// Null if the handle went stale
+	AActor* ResolveActorHandle(FActorRegistryHandle Handle) const;
+
+	// ---------- Spatial ----------
+	// Opts a tagged actor into the spatial index. Only movable actors are tracked after this; they leave with their last tag.
+	UFUNCTION(BlueprintCallable, Category="Registry|Spatial")
+	void RegisterSpatialActor(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category="Registry|Spatial")
+	void UnregisterSpatialActor(AActor* Actor);
+
+	// Actors registered under Root or one of its children join the spatial index on their own, including ones already registered
+	void AddSpatialTagRoot(FGameplayTag Root);
+
+	// Spatial queries only see opted-in actors. An empty Query matches all of them.
+	void ForEachActorInRadius(const FActorTagQuery& Query, const FVector& Center, float Radius, TFunctionRef<bool(AActor*)> Visitor) const;
+	void ForEachActorInBox(const FActorTagQuery& Query, const FBox& Box, TFunctionRef<bool(AActor*)> Visitor) const;
+
+	// Appends up to K matching actors, nearest first. MaxDistance <= 0 means no limit.
+	template<typename AllocatorType>
+	int32 FindNearestActors(const FActorTagQuery& Query, const FVector& Location, int32 K, TArray<AActor*, AllocatorType>& OutActors, float MaxDistance = 0.f) const
+	{
+		TArray<int32, TInlineAllocator<16>> Nearest;
+		CollectNearestSlots(Query, Location, K, MaxDistance, Nearest);
+		for (const int32 Slot : Nearest)
+		{
+			OutActors.Add(Slots[Slot].Actor);
+		}
+		return Nearest.Num();
+	}
+
+	AActor* FindNearestActor(const FActorTagQuery& Query, const FVector& Location, float MaxDistance = 0.f) const;
 	
 	// ---------- Save System ----------
 	UFUNCTION(BlueprintCallable, Category="Registry|Save")
@@ -51,6 +142,10 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category="Registry|Save|Data")
     AActor* GetActorByGuid(FGuid ActorGuid) const;
 
+    // Returns an invalid Guid if the actor was never registered as saveable
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Registry|Save|Data")
+    FGuid GetGuidForActor(const AActor* Actor) const;
+
     // Returns all actors that need to be saved 
     UFUNCTION(BlueprintCallable, BlueprintPure, Category="Registry|Save|Data")
     TArray<AActor*> GetAllSaveableActors() const;
@@ -59,14 +154,108 @@ public:
 
 protected:
 
+	// Registered actors live in slots until they unregister their last tag or end play
+	struct FActorSlot
+	{
+		AActor* Actor = nullptr;
+		uint32 Generation = 0;
+
+		// Reverse index: the exact tags this actor is registered under
+		TArray<FGameplayTag, TInlineAllocator<4>> Tags;
+
+		// Spatial index, for actors that opted in
+		bool bSpatial = false;
+		FVector Location = FVector::ZeroVector;
+		FIntVector Cell = FIntVector::ZeroValue;
+		TWeakObjectPtr<USceneComponent> SpatialRoot;
+		FDelegateHandle TransformHandle;
+	};
+
+	// Slot indices under one tag: dense for iteration, with a position map for O(1) membership and removal.
+	// Counts says how many of the slot's registrations the entry stands for (always 1 for exact tags).
+	struct FTagMembers
+	{
+		TArray<int32> Slots;
+		TArray<int32> Counts;
+		TMap<int32, int32> Positions;
+
+		int32 Num() const { return Slots.Num(); }
+		bool Contains(int32 Slot) const { return Positions.Contains(Slot); }
+
+		// True if the slot is new to the list
+		bool Add(int32 Slot);
+		// True if the slot's last reference was removed
+		bool Remove(int32 Slot);
+	};
+
+	// A query's tags resolved to index lists once, so each candidate slot costs a few probes
+	struct FResolvedTagQuery
+	{
+		TArray<const FTagMembers*, TInlineAllocator<4>> AllSets;
+		TArray<const FTagMembers*, TInlineAllocator<4>> AnySets;
+		TArray<const FTagMembers*, TInlineAllocator<2>> NoneSets;
+
+		// Driver is the list the slot came from and isn't probed again
+		bool Matches(int32 Slot, const FTagMembers* Driver = nullptr, bool bCheckAny = true) const;
+	};
+
+	// False if nothing can match Query
+	bool ResolveQuery(const FActorTagQuery& Query, FResolvedTagQuery& OutResolved) const;
+
 	//Tags
-	void PruneTag(FGameplayTag Tag);
+	int32 AcquireSlot(AActor* Actor);
+	void ReleaseSlot(int32 Slot);
+
+	// Takes the slot out of its tags' lists only, then frees it
+	void RemoveSlot(int32 Slot);
+
+	void HandleLevelRemoved(ULevel* Level, UWorld* World);
+
+	// Adds or removes one reference to the slot under Tag and every parent of Tag
+	void UpdateHierarchyIndex(int32 Slot, FGameplayTag Tag, bool bAdd);
+
+	// Slots are freed here, so queries never hold a destroyed actor
+	UFUNCTION()
+	void HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	UFUNCTION()
+	void HandleActorDestroyed(AActor* DestroyedActor);
+
+	//Spatial
+	void RemoveSpatial(int32 Slot);
+	void HandleSpatialTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 Slot);
+	void ForEachSpatialSlot(const FIntVector& MinCell, const FIntVector& MaxCell, TFunctionRef<bool(int32)> Visitor) const;
+	void CollectNearestSlots(const FActorTagQuery& Query, const FVector& Location, int32 K, float MaxDistance, TArray<int32, TInlineAllocator<16>>& OutSlots) const;
 
 private:
 
-	TMap<FGameplayTag, TSet<TWeakObjectPtr<AActor>>> TagToActors;
+	TArray<FActorSlot> Slots;
+	TArray<int32> FreeSlots;
+	TMap<TObjectKey<AActor>, int32> ActorToSlot;
+
+	FDelegateHandle LevelRemovedHandle;
+
+	// Exact registrations
+	TMap<FGameplayTag, FTagMembers> TagToActors;
+
+	// Registrations filed under the tag and all of its parents, so GetActors is a single lookup.
+	// The count is how many of the actor's exact tags sit at or below the key.
+	TMap<FGameplayTag, FTagMembers> HierarchyToActors;
+
+	uint32 Version = 0;
+
+	// Uniform grid of slot indices. Bounds only grow while anything is indexed.
+	TMap<FIntVector, TArray<int32>> SpatialCells;
+	FIntVector SpatialCellMin = FIntVector::ZeroValue;
+	FIntVector SpatialCellMax = FIntVector::ZeroValue;
+	int32 NumSpatial = 0;
+
+	FGameplayTagContainer SpatialTagRoots;
 
 	// The "Phonebook" for saving: Maps ID -> Specific Actor
     TMap<FGuid, TWeakObjectPtr<AActor>> GuidToActorMap;
 
+	// Reverse lookup: Actor -> ID
+	TMap<TWeakObjectPtr<const AActor>, FGuid> ActorToGuidMap;
+
 };
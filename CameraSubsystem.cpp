@@ -7,6 +7,19 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogCameraSubsystem, Log, All);
 
+void UCameraSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Camera tags live under "Camera" (e.g. Camera.Hallway.01)
+    const FGameplayTag CameraRoot = FGameplayTag::RequestGameplayTag("Camera", false);
+    const UGameInstance* GI = InWorld.GetGameInstance();
+    if (UActorRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UActorRegistrySubsystem>() : nullptr)
+    {
+        Registry->AddSpatialTagRoot(CameraRoot);
+    }
+}
+
 // =========================================================
 // ACTION: BLEND TO AND BACK (e.g. Security Camera check)
 // =========================================================
@@ -15,13 +28,12 @@ void UCameraSubsystem::BlendToAndBack(FGameplayTag Tag, float BlendTime, float W
     if (!GetWorld()) return;
 
     // 1. Find Camera via Registry
-    TArray<AActor*> Cameras = GetCameras(Tag);
-    if (Cameras.IsEmpty()) 
+    AActor* Chosen = FindCamera(Tag);
+    if (!Chosen) 
     {
         UE_LOG(LogCameraSubsystem, Warning, TEXT("BlendToAndBack: No camera found for tag %s"), *Tag.ToString());
         return; 
     }
-    AActor* Chosen = Cameras[0];
 
     if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
     {
@@ -82,11 +94,8 @@ void UCameraSubsystem::BlendToAndBack(FGameplayTag Tag, float BlendTime, float W
 // =========================================================
 void UCameraSubsystem::BlendToCamera(FGameplayTag Tag, float BlendTime)
 {
-    TArray<AActor*> Cameras = GetCameras(Tag);
-    if (Cameras.IsEmpty()) return;
-
     // Policy: Just grab the first one found
-    AActor* Chosen = Cameras[0];
+    AActor* Chosen = FindCamera(Tag);
 
     if (Chosen)
     {
@@ -140,9 +149,8 @@ void UCameraSubsystem::FadeToCamera(FGameplayTag Tag, float FadeTime, float Wait
 {
     if (!GetWorld()) return;
 
-    TArray<AActor*> Cameras = GetCameras(Tag);
-    if (Cameras.IsEmpty()) return;
-    AActor* NewTarget = Cameras[0];
+    AActor* NewTarget = FindCamera(Tag);
+    if (!NewTarget) return;
 
     APlayerController* PC = GetWorld()->GetFirstPlayerController();
     if (!PC || !PC->PlayerCameraManager) return;
@@ -189,10 +197,7 @@ void UCameraSubsystem::FadeToCamera(FGameplayTag Tag, float FadeTime, float Wait
 // =========================================================
 bool UCameraSubsystem::CutToCamera(FGameplayTag Tag)
 {
-    TArray<AActor*> Cameras = GetCameras(Tag);
-    if (Cameras.IsEmpty()) return false;
-
-    AActor* Chosen = Cameras[0];
+    AActor* Chosen = FindCamera(Tag);
 
     if (Chosen)
     {
@@ -239,3 +244,26 @@ TArray<AActor*> UCameraSubsystem::GetCameras(FGameplayTag Tag) const
     
     return TArray<AActor*>();
 }
+
+AActor* UCameraSubsystem::FindCamera(FGameplayTag Tag) const
+{
+    if (const UGameInstance* GI = GetWorld()->GetGameInstance())
+    {
+        if (auto* Registry = GI->GetSubsystem<UActorRegistrySubsystem>())
+        {
+            const FActorTagQuery Query = FActorTagQuery().All(Tag);
+
+            // Cameras registered with a position: take the one closest to the player
+            const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+            if (const APawn* PlayerPawn = PC ? PC->GetPawn() : nullptr)
+            {
+                if (AActor* Nearest = Registry->FindNearestActor(Query, PlayerPawn->GetActorLocation()))
+                {
+                    return Nearest;
+                }
+            }
+            return Registry->FindFirstActor(Query);
+        }
+    }
+    return nullptr;
+}
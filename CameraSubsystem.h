@@ -14,6 +14,9 @@ class INSIDETFV03_API UCameraSubsystem : public UWorldSubsystem
 	GENERATED_BODY()
 
 public:
+	// Files cameras in the Actor Registry's spatial index, so FindCamera can take the nearest one
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
 	UFUNCTION(BlueprintCallable, Category = "Camera|Blend")
 	void BlendToCamera(FGameplayTag Tag, float BlendTime);
 
@@ -35,6 +38,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Camera|Data")
 	TArray<AActor*> GetCameras(FGameplayTag Tag) const;
 
+	// Camera under Tag (hierarchy search) nearest the player, else the first one. Doesn't build the list.
+	AActor* FindCamera(FGameplayTag Tag) const;
+
 
 
 private:
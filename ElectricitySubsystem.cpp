@@ -2,6 +2,19 @@
 #include "Subsystems/ActorRegistrySubsystem.h"
 #include "GameFramework/Actor.h"
 
+void UElectricitySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (const UGameInstance* GI = InWorld.GetGameInstance())
+    {
+        if (auto* Registry = GI->GetSubsystem<UActorRegistrySubsystem>())
+        {
+            Registry->AddSpatialTagRoot(FGameplayTag::RequestGameplayTag("Electricity.Consumer.Light"));
+        }
+    }
+}
+
 void UElectricitySubsystem::SetCircuitState(FGameplayTag CircuitTag, bool bPowerOn)
 {
     if (!CircuitTag.IsValid()) return;
@@ -31,10 +44,9 @@ void UElectricitySubsystem::SetCircuitState(FGameplayTag CircuitTag, bool bPower
 
 
     // Find intersection: "Actors that are Consumers" AND "Actors on this Circuit"
-    TArray<AActor*> CircuitItems = Registry->GetActorsWithIntersection(
-        FGameplayTag::RequestGameplayTag("Electricity.Consumer"),
-        CircuitTag
-    );
+    // Collected first (on the stack for normal circuits): Power On/Off may register or unregister actors.
+    TArray<AActor*, TInlineAllocator<64>> CircuitItems;
+    Registry->QueryActors(FActorTagQuery().All(FGameplayTag::RequestGameplayTag("Electricity.Consumer")).All(CircuitTag), CircuitItems);
 
     // --- 4. NOTIFY ACTORS ---
     for (AActor* Item : CircuitItems)
@@ -98,15 +110,28 @@ TArray<AActor*> UElectricitySubsystem::GetLightsInRoom(FGameplayTag RoomTag) con
     {
         if (auto* Registry = GI->GetSubsystem<UActorRegistrySubsystem>())
         {
-            return Registry->GetActorsWithIntersection(
-                FGameplayTag::RequestGameplayTag("Electricity.Consumer.Light"),
-                RoomTag
-            );
+            TArray<AActor*> Lights;
+            Registry->QueryActors(FActorTagQuery().All(FGameplayTag::RequestGameplayTag("Electricity.Consumer.Light")).All(RoomTag), Lights);
+            return Lights;
         }
     }
     return TArray<AActor*>();
 }
 
+TArray<AActor*> UElectricitySubsystem::GetLightsNear(FVector Location, float Radius) const
+{
+    TArray<AActor*> Lights;
+    if (const UGameInstance* GI = GetWorld()->GetGameInstance())
+    {
+        if (auto* Registry = GI->GetSubsystem<UActorRegistrySubsystem>())
+        {
+            Registry->ForEachActorInRadius(FActorTagQuery().All(FGameplayTag::RequestGameplayTag("Electricity.Consumer.Light")), Location, Radius,
+                [&Lights](AActor* Light) { Lights.Add(Light); return true; });
+        }
+    }
+    return Lights;
+}
+
 // ---------- SAVE / LOAD ----------
 
 void UElectricitySubsystem::RestoreCircuitStates(const TMap<FGameplayTag, bool>& LoadedStates)
@@ -14,6 +14,9 @@ class INSIDETFV03_API UElectricitySubsystem : public UWorldSubsystem
 
 public:
 
+    // Files lights in the Actor Registry's spatial index (for GetLightsNear)
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
     // ---------- CONTROL ----------
 
     /** * Turns a specific circuit ON or OFF.
@@ -40,6 +43,10 @@ public:
     UFUNCTION(BlueprintPure, Category="Electricity")
     TArray<AActor*> GetLightsInRoom(FGameplayTag RoomTag) const;
 
+    // Returns Lights within Radius of Location. Only sees lights registered as spatial in the Actor Registry.
+    UFUNCTION(BlueprintPure, Category="Electricity")
+    TArray<AActor*> GetLightsNear(FVector Location, float Radius) const;
+
     // ---------- SAVE / LOAD ----------
 
     // Call this when saving the game
@@ -1,6 +1,7 @@
 #include "Subsystems/LevelStateSubsystem.h"
 #include "WorldPartition/DataLayer/DataLayerManager.h"
 #include "WorldPartition/DataLayer/DataLayerInstance.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
 #include "Engine/World.h"
 
 // --- Helper: Get the Manager ---
@@ -58,6 +59,26 @@ bool ULevelStateSubsystem::IsDataLayerActive(FName LayerName) const
     return false;
 }
 
+bool ULevelStateSubsystem::IsDataLayerInState(FName LayerName, EDataLayerRuntimeState TargetState) const
+{
+    UDataLayerManager* Manager = GetDataLayerManager();
+    if (!Manager) return false;
+
+    for (const UDataLayerInstance* LayerInstance : Manager->GetDataLayerInstances())
+    {
+        if (LayerInstance && LayerInstance->GetDataLayerShortName() == LayerName.ToString())
+        {
+            if (Manager->GetDataLayerInstanceEffectiveRuntimeState(LayerInstance) != TargetState) return false;
+
+            // The effective state flips before the cells finish streaming
+            const UWorldPartitionSubsystem* WorldPartition = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>();
+            return !WorldPartition || WorldPartition->IsAllStreamingCompleted();
+        }
+    }
+
+    return false;
+}
+
 // --- Save/Load System ---
 
 TArray<FName> ULevelStateSubsystem::GetActiveLayerNames() const
@@ -25,6 +25,10 @@ public:
     UFUNCTION(BlueprintPure, Category="LevelState")
     bool IsDataLayerActive(FName LayerName) const;
 
+    /** True once the layer has reached TargetState and its cells finished streaming */
+    UFUNCTION(BlueprintPure, Category="LevelState")
+    bool IsDataLayerInState(FName LayerName, EDataLayerRuntimeState TargetState) const;
+
     // --- Save/Load System ---
 
     /** * Returns a list of ALL currently active Data Layer Names.
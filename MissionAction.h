@@ -2,9 +2,24 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "GameplayTagContainer.h"
+#include "Missions/MissionExecutionContext.h"
 #include "MissionAction.generated.h"
 
 
+class UWorld;
+struct FStreamableHandle;
+
+// Per-run scratch for latent actions. Action objects are shared definitions, so they keep nothing themselves.
+struct FMissionLatentState
+{
+    TWeakObjectPtr<UWorld> World;
+
+    // Game time (pauses with the game) when the action started
+    double StartTime = 0.0;
+
+    TSharedPtr<FStreamableHandle> LoadHandle;
+};
+
 // Abstract base for all actions (Start, Complete, Step Actions)
 UCLASS(Abstract, BlueprintType, EditInlineNew, DefaultToInstanced)
 class INSIDETFV03_API UMissionAction : public UObject
@@ -13,8 +28,21 @@ class INSIDETFV03_API UMissionAction : public UObject
 
 public:
     // The main entry point. 
-    // We pass ContextActor (Player Character) so the Action can find the World/GameInstance.
-    virtual void ExecuteAction(AActor* ContextActor) const {};
+    // Context carries the ContextActor (Player Character), World and subsystems, plus cached registry queries.
+    virtual void ExecuteAction(const FMissionExecutionContext& Context) const {};
+
+    // --- Latent ---
+    // A latent action holds back the actions after it in the same list until PollLatent returns true.
+    // The Mission Subsystem calls BeginLatent instead of ExecuteAction, then PollLatent once per frame.
+
+    virtual bool IsLatent() const { return false; }
+
+    virtual void BeginLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const { ExecuteAction(Context); }
+
+    virtual bool PollLatent(const FMissionExecutionContext& Context, FMissionLatentState& State) const { return true; }
+
+    // The wait is abandoned after this long (game time) so a broken action can't stall its list. 0 = never.
+    virtual float GetLatentTimeout() const { return 30.f; }
 };
 
 
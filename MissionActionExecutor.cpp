@@ -0,0 +1,187 @@
+// Periphery -- EvEGames -- MissionActionExecutor.cpp
+
+#include "Missions/MissionActionExecutor.h"
+#include "Missions/MissionLog.h"
+#include "Engine/World.h"
+
+// ---------- Queueing ----------
+
+void FMissionActionExecutor::Run(TArrayView<const TObjectPtr<UMissionAction>> Actions, const FMissionExecutionContext& Context, double BudgetSeconds)
+{
+    if (Actions.Num() == 0) return;
+
+    TSharedPtr<FActionList> List = MakeShared<FActionList>();
+    List->Actions.Reserve(Actions.Num());
+    for (const TObjectPtr<UMissionAction>& Action : Actions)
+    {
+        List->Actions.Add(Action.Get());
+    }
+    List->Context = Context.ContextActor;
+
+    Start(MoveTemp(List), Context, BudgetSeconds);
+}
+
+void FMissionActionExecutor::Run(const UMissionAction* Action, const FMissionExecutionContext& Context, double BudgetSeconds)
+{
+    if (!Action) return;
+
+    TSharedPtr<FActionList> List = MakeShared<FActionList>();
+    List->Actions.Add(Action);
+    List->Context = Context.ContextActor;
+
+    Start(MoveTemp(List), Context, BudgetSeconds);
+}
+
+void FMissionActionExecutor::Start(TSharedPtr<FActionList> List, const FMissionExecutionContext& Context, double BudgetSeconds)
+{
+    BaseContext = Context;
+    FrameBudgetSeconds = BudgetSeconds;
+
+    // Nothing may have ticked us since the last run, so the frame boundary is tracked here too
+    if (FrameNumber != GFrameCounter)
+    {
+        FrameNumber = GFrameCounter;
+        FrameSpentSeconds = 0.0;
+        bRanThisFrame = false;
+    }
+
+    // Lists the budget cut off run first, so a new top-level list queues behind them.
+    // Nested runs (from an action) still run depth-first, and lists waiting on a latent action don't hold others back.
+    const bool bBehindDeferred = Depth == 0 && Pending.ContainsByPredicate([](const TSharedPtr<FActionList>& Queued) { return !Queued->bWaiting; });
+
+    // Run as much as fits right away, the rest waits for Tick
+    if (bBehindDeferred || !Continue(*List))
+    {
+        Pending.Add(MoveTemp(List));
+    }
+}
+
+void FMissionActionExecutor::Tick(const FMissionExecutionContext& Context, double BudgetSeconds)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(FMissionActionExecutor::Tick);
+    BaseContext = Context;
+    FrameBudgetSeconds = BudgetSeconds;
+    FrameNumber = GFrameCounter;
+    FrameSpentSeconds = 0.0;
+    bRanThisFrame = false;
+
+    // Index loop: actions may start new lists, which get appended
+    for (int32 i = 0; i < Pending.Num(); i++)
+    {
+        TSharedPtr<FActionList> List = Pending[i];
+        if (Continue(*List))
+        {
+            List->Next = List->Actions.Num();
+        }
+    }
+
+    Pending.RemoveAll([](const TSharedPtr<FActionList>& List) { return List->Next >= List->Actions.Num(); });
+}
+
+void FMissionActionExecutor::Reset()
+{
+    Pending.Reset();
+    BaseContext = FMissionExecutionContext();
+    FrameSpentSeconds = 0.0;
+}
+
+// ---------- Execution ----------
+
+bool FMissionActionExecutor::HasBudget() const
+{
+    return FrameBudgetSeconds <= 0.0 || !bRanThisFrame || FrameSpentSeconds < FrameBudgetSeconds;
+}
+
+bool FMissionActionExecutor::Continue(FActionList& List)
+{
+    while (List.Next < List.Actions.Num())
+    {
+        const UMissionAction* Action = List.Actions[List.Next].Get();
+        if (!Action)
+        {
+            List.Next++;
+            List.bWaiting = false;
+            continue;
+        }
+
+        FMissionExecutionContext Context = BaseContext;
+        Context.ContextActor = List.Context.Get();
+
+        // 1. Waiting on a latent action
+        if (List.bWaiting)
+        {
+            const UWorld* LatentWorld = List.Latent.World.Get();
+            const float Timeout = Action->GetLatentTimeout();
+            const bool bTimedOut = Timeout > 0.f && LatentWorld && LatentWorld->GetTimeSeconds() - List.Latent.StartTime > Timeout;
+
+            if (!Action->PollLatent(Context, List.Latent) && !bTimedOut) return false;
+
+            if (bTimedOut)
+            {
+                UE_LOG(LogPeripheryMission, Warning, TEXT("MissionActionExecutor: %s timed out after %.1fs, continuing its list"), *Action->GetName(), Timeout);
+            }
+
+            if (List.Latent.LoadHandle.IsValid())
+            {
+                List.RetainedHandles.Add(MoveTemp(List.Latent.LoadHandle));
+            }
+            List.Latent = FMissionLatentState();
+            List.bWaiting = false;
+            List.Next++;
+            continue;
+        }
+
+        // 2. Out of time for this frame
+        if (!HasBudget()) return false;
+
+        // 3. Run it
+        const double StartTime = FPlatformTime::Seconds();
+        Depth++;
+
+        if (Action->IsLatent())
+        {
+            UWorld* CurrentWorld = BaseContext.World;
+            List.Latent.World = CurrentWorld;
+            List.Latent.StartTime = CurrentWorld ? CurrentWorld->GetTimeSeconds() : 0.0;
+            List.bWaiting = true;
+            Action->BeginLatent(Context, List.Latent);
+        }
+        else
+        {
+            Action->ExecuteAction(Context);
+            List.Next++;
+        }
+
+        Depth--;
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+        if (Depth == 0)
+        {
+            FrameSpentSeconds += Elapsed;
+            bRanThisFrame = true;
+        }
+
+        FMissionActionStats& ActionStats = Stats.FindOrAdd(Action->GetClass()->GetFName());
+        ActionStats.Count++;
+        ActionStats.TotalMs += Elapsed * 1000.0;
+        ActionStats.MaxMs = FMath::Max(ActionStats.MaxMs, Elapsed * 1000.0);
+    }
+
+    return true;
+}
+
+// ---------- Stats ----------
+
+void FMissionActionExecutor::LogStats() const
+{
+    TArray<FName> Classes;
+    Stats.GenerateKeyArray(Classes);
+    Classes.Sort([this](const FName& A, const FName& B) { return Stats[A].TotalMs > Stats[B].TotalMs; });
+
+    UE_LOG(LogPeripheryMission, Display, TEXT("MissionActionExecutor: %d lists pending"), Pending.Num());
+    for (const FName& Class : Classes)
+    {
+        const FMissionActionStats& ActionStats = Stats[Class];
+        UE_LOG(LogPeripheryMission, Display, TEXT("  %-32s x%-6d total %9.3f ms  avg %7.3f ms  max %7.3f ms"),
+            *Class.ToString(), ActionStats.Count, ActionStats.TotalMs, ActionStats.TotalMs / ActionStats.Count, ActionStats.MaxMs);
+    }
+}
@@ -0,0 +1,79 @@
+// Periphery -- EvEGames -- MissionActionExecutor.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Missions/Actions/MissionAction.h"
+
+struct FMissionActionStats
+{
+	int32 Count = 0;
+
+	// Inclusive of anything the action triggered synchronously
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+};
+
+/**
+ * Runs mission action lists in order, within a per-frame time budget.
+ * A list runs immediately while the frame has budget left (depth-first, like a direct call) and continues
+ * on later frames otherwise. Once a list has been deferred, new top-level lists queue behind it (FIFO).
+ * Latent actions hold back the rest of their list until they report done.
+ */
+class INSIDETFV03_API FMissionActionExecutor
+{
+public:
+
+	// BudgetSeconds <= 0 means no limit. The list keeps Context's ContextActor; the rest is refreshed by later calls.
+	void Run(TArrayView<const TObjectPtr<UMissionAction>> Actions, const FMissionExecutionContext& Context, double BudgetSeconds);
+	void Run(const UMissionAction* Action, const FMissionExecutionContext& Context, double BudgetSeconds);
+
+	// Starts a new frame and continues pending lists. Always runs at least one action if any is ready.
+	void Tick(const FMissionExecutionContext& Context, double BudgetSeconds);
+
+	bool HasWork() const { return Pending.Num() > 0; }
+
+	void Reset();
+
+	// <Action class, cost>
+	const TMap<FName, FMissionActionStats>& GetStats() const { return Stats; }
+	void LogStats() const;
+
+private:
+
+	struct FActionList
+	{
+		TArray<TWeakObjectPtr<const UMissionAction>> Actions;
+		int32 Next = 0;
+
+		TWeakObjectPtr<AActor> Context;
+
+		// The action at Next has begun and is being polled
+		bool bWaiting = false;
+		FMissionLatentState Latent;
+
+		// Loads started by earlier latent actions, kept until the list is done
+		TArray<TSharedPtr<FStreamableHandle>> RetainedHandles;
+	};
+
+	void Start(TSharedPtr<FActionList> List, const FMissionExecutionContext& Context, double BudgetSeconds);
+
+	// Runs the list until it finishes (true), waits on a latent action, or the frame budget runs out.
+	bool Continue(FActionList& List);
+
+	bool HasBudget() const;
+
+	TArray<TSharedPtr<FActionList>> Pending;
+	// World, subsystems and query cache of the latest call. Each list supplies its own ContextActor.
+	FMissionExecutionContext BaseContext;
+
+	double FrameBudgetSeconds = 0.0;
+	double FrameSpentSeconds = 0.0;
+	bool bRanThisFrame = false;
+	uint64 FrameNumber = 0;
+
+	// Nested runs (an action completing an objective) are timed by the outermost action
+	int32 Depth = 0;
+
+	TMap<FName, FMissionActionStats> Stats;
+};
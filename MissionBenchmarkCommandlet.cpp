@@ -0,0 +1,346 @@
+// Periphery -- EvEGames -- MissionBenchmarkCommandlet.cpp
+
+#include "Commandlets/MissionBenchmarkCommandlet.h"
+#include "Subsystems/MissionSubsystem.h"
+#include "Subsystems/ActorRegistrySubsystem.h"
+#include "Missions/MissionData.h"
+#include "Missions/MissionLog.h"
+#include "Missions/PeripheryMissionSettings.h"
+#include "Missions/Objectives/Objective_Count.h"
+#include "Missions/Objectives/Objective_Kill.h"
+#include "Missions/Objectives/Objective_Simple.h"
+#include "Missions/Objectives/Objective_Checklist.h"
+#include "Missions/Objectives/Objective_Sequence.h"
+#include "Missions/Objectives/Objective_Gatekeeper.h"
+#include "GameplayTagsManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMissionBenchmark, Log, All);
+
+namespace
+{
+    // Counts game thread allocator calls while bCounting is set. Worker and loading threads go straight through.
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { Count1(); return Inner->Malloc(Count, Alignment); }
+        virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override { Count1(); return Inner->Realloc(Ptr, NewSize, Alignment); }
+        virtual void Free(void* Ptr) override { Inner->Free(Ptr); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual const TCHAR* GetDescriptiveName() override { return TEXT("MissionBenchmarkCountingMalloc"); }
+
+        FMalloc* Inner;
+        TAtomic<int64> Allocs { 0 };
+        TAtomic<bool> bCounting { false };
+
+    private:
+
+        void Count1()
+        {
+            if (bCounting.Load(EMemoryOrder::Relaxed) && IsInGameThread()) Allocs.IncrementExchange();
+        }
+    };
+
+    // Installed on first use and never removed or freed: any thread may be inside it at any time after that
+    FCountingMalloc& GetCountingMalloc()
+    {
+        static FCountingMalloc* Counter = []()
+        {
+            FCountingMalloc* NewCounter = new FCountingMalloc(GMalloc);
+            GMalloc = NewCounter;
+            return NewCounter;
+        }();
+        return *Counter;
+    }
+
+    struct FPhaseResult
+    {
+        FString Name;
+        int64 Operations = 0;
+        double Seconds = 0.0;
+        int64 Allocs = 0;
+
+        // Change in process used physical memory across the phase (can be negative)
+        int64 UsedDeltaBytes = 0;
+    };
+
+    // Runs Body with timing and allocation counting around it
+    template<typename FuncType>
+    FPhaseResult MeasurePhase(const TCHAR* Name, int64 Operations, FuncType&& Body)
+    {
+        FCountingMalloc& Counter = GetCountingMalloc();
+        const int64 AllocsBefore = Counter.Allocs.Load();
+        const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+
+        Counter.bCounting = true;
+        const double Start = FPlatformTime::Seconds();
+        Body();
+        const double Seconds = FPlatformTime::Seconds() - Start;
+        Counter.bCounting = false;
+
+        FPhaseResult Result;
+        Result.Name = Name;
+        Result.Operations = FMath::Max<int64>(Operations, 1);
+        Result.Seconds = Seconds;
+        Result.Allocs = Counter.Allocs.Load() - AllocsBefore;
+        Result.UsedDeltaBytes = (int64)FPlatformMemory::GetStats().UsedPhysical - (int64)UsedBefore;
+        return Result;
+    }
+
+    // Registers the generated tags at runtime, the same way game feature plugins add theirs
+    bool RegisterBenchmarkTags(const TArray<FString>& TagNames)
+    {
+        const FString TagDir = FPaths::ProjectSavedDir() / TEXT("MissionBenchmark") / TEXT("Tags");
+
+        FString Ini = TEXT("[/Script/GameplayTags.GameplayTagsList]\n");
+        for (const FString& TagName : TagNames)
+        {
+            Ini += FString::Printf(TEXT("GameplayTagList=(Tag=\"%s\",DevComment=\"\")\n"), *TagName);
+        }
+        if (!FFileHelper::SaveStringToFile(Ini, *(TagDir / TEXT("MissionBenchmarkTags.ini")))) return false;
+
+        UGameplayTagsManager::Get().AddTagIniSearchPath(TagDir);
+        return true;
+    }
+
+    FGameplayTag Tag(const FString& TagName)
+    {
+        return FGameplayTag::RequestGameplayTag(FName(*TagName));
+    }
+}
+
+UMissionBenchmarkCommandlet::UMissionBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UMissionBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 NumMissions = 32;
+    int32 NumPerType = 8;
+    int32 NumEvents = 100000;
+    int32 NumSources = 64;
+    FString CsvPath = FPaths::ProjectSavedDir() / TEXT("MissionBenchmark") / TEXT("MissionBenchmark.csv");
+
+    FParse::Value(*Params, TEXT("Missions="), NumMissions);
+    FParse::Value(*Params, TEXT("Objectives="), NumPerType);
+    FParse::Value(*Params, TEXT("Events="), NumEvents);
+    FParse::Value(*Params, TEXT("Sources="), NumSources);
+    FParse::Value(*Params, TEXT("Csv="), CsvPath);
+
+    NumMissions = FMath::Max(NumMissions, 1);
+    NumPerType = FMath::Max(NumPerType, 1);
+    NumSources = FMath::Max(NumSources, 1);
+
+    // Swap the counting allocator in now, long before anything is measured
+    GetCountingMalloc();
+
+    // 1. Tags: Bench.Mission.<i>, Bench.Objective.<Type>.<j>, Bench.Event.<j>, Bench.Event.Finish
+    const TCHAR* TypeNames[] = { TEXT("Count"), TEXT("Kill"), TEXT("Simple"), TEXT("Checklist"), TEXT("Sequence"), TEXT("Gatekeeper") };
+
+    TArray<FString> TagNames;
+    for (int32 i = 0; i < NumMissions; i++) TagNames.Add(FString::Printf(TEXT("Bench.Mission.%d"), i));
+    for (int32 j = 0; j < NumPerType; j++)
+    {
+        TagNames.Add(FString::Printf(TEXT("Bench.Event.%d"), j));
+        for (const TCHAR* TypeName : TypeNames) TagNames.Add(FString::Printf(TEXT("Bench.Objective.%s.%d"), TypeName, j));
+    }
+    TagNames.Add(TEXT("Bench.Event.Finish"));
+
+    if (!RegisterBenchmarkTags(TagNames))
+    {
+        UE_LOG(LogMissionBenchmark, Error, TEXT("Could not register benchmark tags"));
+        return 1;
+    }
+
+    // 2. Fresh game instance. Keep everything resident and dispatch inline.
+    UPeripheryMissionSettings* Settings = GetMutableDefault<UPeripheryMissionSettings>();
+    Settings->bQueueMissionEvents = false;
+    Settings->MissionAssetBudgetKB = MAX_int32;
+    Settings->PrefetchProgressThreshold = 1.f;
+
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+    GameInstance->InitializeStandalone();
+    UWorld* World = GameInstance->GetWorld();
+    UMissionSubsystem* MissionSys = GameInstance->GetSubsystem<UMissionSubsystem>();
+    UActorRegistrySubsystem* Registry = GameInstance->GetSubsystem<UActorRegistrySubsystem>();
+    if (!World || !MissionSys || !Registry)
+    {
+        UE_LOG(LogMissionBenchmark, Error, TEXT("Could not create the game instance"));
+        return 1;
+    }
+
+    // 3. Missions. Every objective starts active; targets are out of reach so the event phase
+    // measures pure dispatch, and Bench.Event.Finish + explicit completion drive the completion phase.
+    const FGameplayTag FinishEvent = Tag(TEXT("Bench.Event.Finish"));
+    // Both event phases feed the same objectives
+    const int32 Unreachable = 2 * NumEvents + 1;
+
+    TArray<UMissionData*> Missions;
+    for (int32 i = 0; i < NumMissions; i++)
+    {
+        UMissionData* Mission = NewObject<UMissionData>(GetTransientPackage());
+        Mission->MissionID = Tag(FString::Printf(TEXT("Bench.Mission.%d"), i));
+
+        for (int32 j = 0; j < NumPerType; j++)
+        {
+            const FGameplayTag Event = Tag(FString::Printf(TEXT("Bench.Event.%d"), j));
+            auto ObjectiveTag = [j](const TCHAR* TypeName) { return Tag(FString::Printf(TEXT("Bench.Objective.%s.%d"), TypeName, j)); };
+
+            UObjective_Count* Count = NewObject<UObjective_Count>(Mission);
+            Count->TargetEvent = Event;
+            Count->TargetCount = Unreachable;
+            Count->bRequireUniqueSources = (j % 2) == 0;
+            Count->ObjectiveID = ObjectiveTag(TEXT("Count"));
+
+            UObjective_Kill* Kill = NewObject<UObjective_Kill>(Mission);
+            Kill->EnemyDeathTag = Event;
+            Kill->RequiredKills = Unreachable;
+            Kill->bRequirePlayerSource = false;
+            Kill->ObjectiveID = ObjectiveTag(TEXT("Kill"));
+
+            UObjective_Simple* Simple = NewObject<UObjective_Simple>(Mission);
+            Simple->TargetEvent = FinishEvent;
+            Simple->ObjectiveID = ObjectiveTag(TEXT("Simple"));
+
+            UObjective_Checklist* Checklist = NewObject<UObjective_Checklist>(Mission);
+            Checklist->RequiredTags = { Event, FinishEvent };
+            Checklist->ObjectiveID = ObjectiveTag(TEXT("Checklist"));
+
+            UObjective_Sequence* Sequence = NewObject<UObjective_Sequence>(Mission);
+            FObjectiveStepDefinition& Step = Sequence->Steps.AddDefaulted_GetRef();
+            FStepRequirement& Requirement = Step.RequiredEventsToCompleteStep.AddDefaulted_GetRef();
+            Requirement.RequiredEventTag = Event;
+            Requirement.RequireUniqueSources = false;
+            Requirement.NumberOfTimesEventMustOccur = Unreachable;
+            Sequence->ObjectiveID = ObjectiveTag(TEXT("Sequence"));
+
+            UObjective_Gatekeeper* Gatekeeper = NewObject<UObjective_Gatekeeper>(Mission);
+            Gatekeeper->RequiredObjectives = { Simple->ObjectiveID, Checklist->ObjectiveID };
+            Gatekeeper->ObjectiveID = ObjectiveTag(TEXT("Gatekeeper"));
+
+            for (UMissionObjective* Objective : TArray<UMissionObjective*>{ Count, Kill, Simple, Checklist, Sequence, Gatekeeper })
+            {
+                Objective->bStartAutomatically = true;
+                Mission->ObjectiveArray.Add(Objective);
+            }
+        }
+
+        TArray<FString> GraphErrors;
+        Mission->CompileRuntimeGraph(GraphErrors);
+        MissionSys->RegisterMissionAsset(Mission);
+        Missions.Add(Mission);
+    }
+
+    TArray<FMissionEventRecord> Events;
+    Events.Reserve(NumEvents);
+    {
+        TArray<AActor*> Sources;
+        for (int32 s = 0; s < NumSources; s++)
+        {
+            AActor* Source = World->SpawnActor<AActor>();
+            Registry->RegisterSaveableActor(Source, FGuid::NewGuid());
+            Sources.Add(Source);
+        }
+
+        for (int32 e = 0; e < NumEvents; e++)
+        {
+            FMissionEventRecord& Record = Events.AddDefaulted_GetRef();
+            Record.EventTag = Tag(FString::Printf(TEXT("Bench.Event.%d"), e % NumPerType));
+            Record.SourceActor = Sources[e % NumSources];
+        }
+    }
+
+    // Objectives completed explicitly in the completion phase
+    TArray<TPair<FGameplayTag, FGameplayTag>> ExplicitCompletions;
+    for (const UMissionData* Mission : Missions)
+    {
+        for (int32 j = 0; j < NumPerType; j++)
+        {
+            for (const TCHAR* TypeName : { TEXT("Count"), TEXT("Kill"), TEXT("Sequence") })
+            {
+                ExplicitCompletions.Emplace(Mission->MissionID, Tag(FString::Printf(TEXT("Bench.Objective.%s.%d"), TypeName, j)));
+            }
+        }
+    }
+
+    // Per-call logging would dominate the numbers
+    const ELogVerbosity::Type SavedVerbosity = LogPeripheryMission.GetVerbosity();
+    LogPeripheryMission.SetVerbosity(ELogVerbosity::Warning);
+
+    const int32 NumObjectives = NumMissions * NumPerType * UE_ARRAY_COUNT(TypeNames);
+    TArray<FPhaseResult> Results;
+
+    // 4. Phases
+    Results.Add(MeasurePhase(TEXT("StartMission+Activate"), NumObjectives, [&]()
+    {
+        for (const UMissionData* Mission : Missions) MissionSys->StartMission(Mission->MissionID);
+    }));
+
+    Results.Add(MeasurePhase(TEXT("EmitActorEvent"), NumEvents, [&]()
+    {
+        for (const FMissionEventRecord& Record : Events) MissionSys->EmitActorEvent(Record.SourceActor.Get(), Record.EventTag);
+    }));
+
+    Results.Add(MeasurePhase(TEXT("EmitActorEvents(Bulk)"), NumEvents, [&]()
+    {
+        MissionSys->EmitActorEvents(Events);
+    }));
+
+    Results.Add(MeasurePhase(TEXT("CompleteObjective"), NumObjectives, [&]()
+    {
+        // Simple + Checklist finish on the event, Gatekeepers chain off them
+        MissionSys->EmitActorEventCount(FinishEvent, 1);
+
+        for (const TPair<FGameplayTag, FGameplayTag>& Pair : ExplicitCompletions)
+        {
+            MissionSys->CompleteObjective(Pair.Key, Pair.Value, true);
+        }
+    }));
+
+    LogPeripheryMission.SetVerbosity(SavedVerbosity);
+
+    // 5. Report
+    const FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
+    const double ProcessPeakMB = MemStats.PeakUsedPhysical / (1024.0 * 1024.0);
+    const int32 FinishedMissions = MissionSys->CompletedMissions.Num();
+
+    const bool bNewFile = !FPaths::FileExists(CsvPath);
+    FString Csv = bNewFile ? TEXT("Timestamp,Phase,Missions,ObjectivesPerType,Operations,TotalMs,NsPerOp,AllocsPerOp,UsedDeltaMB,ProcessPeakUsedMB\n") : FString();
+    const FString Timestamp = FDateTime::UtcNow().ToIso8601();
+
+    for (const FPhaseResult& Result : Results)
+    {
+        const double NsPerOp = Result.Seconds * 1e9 / Result.Operations;
+        const double AllocsPerOp = (double)Result.Allocs / Result.Operations;
+        const double UsedDeltaMB = Result.UsedDeltaBytes / (1024.0 * 1024.0);
+
+        UE_LOG(LogMissionBenchmark, Display, TEXT("%-24s %8lld ops  %10.3f ms  %10.1f ns/op  %6.2f allocs/op  %+8.1f MB"),
+            *Result.Name, Result.Operations, Result.Seconds * 1000.0, NsPerOp, AllocsPerOp, UsedDeltaMB);
+
+        // The process peak is the same for every phase; it's repeated so each row stands alone
+        Csv += FString::Printf(TEXT("%s,%s,%d,%d,%lld,%.3f,%.1f,%.3f,%.1f,%.1f\n"), *Timestamp, *Result.Name,
+            NumMissions, NumPerType, Result.Operations, Result.Seconds * 1000.0, NsPerOp, AllocsPerOp, UsedDeltaMB, ProcessPeakMB);
+    }
+
+    UE_LOG(LogMissionBenchmark, Display, TEXT("Process peak used physical: %.1f MB, missions finished: %d / %d"), ProcessPeakMB, FinishedMissions, NumMissions);
+
+    if (!FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+    {
+        UE_LOG(LogMissionBenchmark, Error, TEXT("Could not write %s"), *CsvPath);
+    }
+
+    GameInstance->Shutdown();
+    return FinishedMissions == NumMissions ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+// Periphery -- EvEGames -- MissionBenchmarkCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MissionBenchmarkCommandlet.generated.h"
+
+/**
+ * Microbenchmark for the Mission Subsystem. Generates Missions x (Objectives of every type) in memory,
+ * then times activation, event dispatch and completion. Appends one CSV row per phase.
+ *
+ * UnrealEditor-Cmd.exe InsideTFv03.uproject -run=MissionBenchmark -nullrhi
+ *     [-Missions=32] [-Objectives=8] [-Events=100000] [-Sources=64] [-Csv=<file>]
+ */
+UCLASS()
+class INSIDETFV03_API UMissionBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UMissionBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -2,6 +2,12 @@
 
 
 #include "Missions/MissionData.h"
+#include "Missions/MissionLog.h"
+#include "UObject/ObjectSaveContext.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
 
 FPrimaryAssetId UMissionData::GetPrimaryAssetId() const
 {
@@ -14,6 +20,86 @@ FPrimaryAssetId UMissionData::GetPrimaryAssetId() const
     return FPrimaryAssetId(GetClass()->GetFName(), GetFName());
 }
 
+void UMissionData::PostLoad()
+{
+    Super::PostLoad();
+
+    // The graph and layouts read the instanced objectives, which may not be post-loaded yet under async loading
+    for (UMissionObjective* Objective : ObjectiveArray)
+    {
+        if (Objective)
+        {
+            Objective->ConditionalPostLoad();
+        }
+    }
+
+#if WITH_EDITOR
+    // Objective classes may have changed since the asset was saved
+    const bool bCompile = true;
+#else
+    // Cooked assets carry their graph; only assets saved before it existed need compiling
+    const bool bCompile = !RuntimeGraph.IsCompiled();
+#endif
+
+    if (!bCompile)
+    {
+        BuildStorageLayouts();
+        return;
+    }
+
+    TArray<FString> Errors;
+    if (!CompileRuntimeGraph(Errors))
+    {
+        for (const FString& Error : Errors)
+        {
+            UE_LOG(LogPeripheryMission, Warning, TEXT("MissionData: %s: %s"), *GetName(), *Error);
+        }
+    }
+}
+
+void UMissionData::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+    Super::PreSave(ObjectSaveContext);
+
+    TArray<FString> Errors;
+    if (CompileRuntimeGraph(Errors)) return;
+
+    // An Error during cook fails it, so broken missions never ship
+    const bool bCooking = ObjectSaveContext.IsCooking();
+    for (const FString& Error : Errors)
+    {
+        if (bCooking)
+        {
+            UE_LOG(LogPeripheryMission, Error, TEXT("MissionData: %s: %s"), *GetPathName(), *Error);
+        }
+        else
+        {
+            UE_LOG(LogPeripheryMission, Warning, TEXT("MissionData: %s: %s"), *GetPathName(), *Error);
+        }
+    }
+}
+
+// ---------- Runtime Graph ----------
+
+bool UMissionData::CompileRuntimeGraph(TArray<FString>& OutErrors)
+{
+    BuildStorageLayouts();
+    return FMissionRuntimeGraph::Compile(ObjectiveArray, RuntimeGraph, OutErrors);
+}
+
+void UMissionData::BuildStorageLayouts()
+{
+    for (UMissionObjective* Obj : ObjectiveArray)
+    {
+        if (Obj) Obj->BuildStorageLayout();
+    }
+}
+
+const UMissionObjective* UMissionData::FindObjective(FGameplayTag ObjectiveID) const
+{
+    return GetObjectiveAt(FindObjectiveIndex(ObjectiveID));
+}
+
 #if WITH_EDITOR
 void UMissionData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -58,5 +144,26 @@ void UMissionData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChanged
             }
         }
     }
+
+    // Any edit may touch IDs, links or auto-start flags
+    TArray<FString> Errors;
+    CompileRuntimeGraph(Errors);
+}
+
+EDataValidationResult UMissionData::IsDataValid(FDataValidationContext& Context) const
+{
+    EDataValidationResult Result = Super::IsDataValid(Context);
+
+    FMissionRuntimeGraph Graph;
+    TArray<FString> Errors;
+    if (!FMissionRuntimeGraph::Compile(ObjectiveArray, Graph, Errors))
+    {
+        for (const FString& Error : Errors)
+        {
+            Context.AddError(FText::FromString(Error));
+        }
+        Result = EDataValidationResult::Invalid;
+    }
+    return Result;
 }
 #endif
\ No newline at end of file
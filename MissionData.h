@@ -5,6 +5,7 @@
 #include "Engine/DataAsset.h"
 #include "GameplayTagContainer.h"
 #include "Missions/Objectives/MissionObjective.h" 
+#include "Missions/MissionRuntimeGraph.h"
 #include "MissionData.generated.h"
 
 /**
@@ -34,10 +35,44 @@ public:
 
     virtual FPrimaryAssetId GetPrimaryAssetId() const override;
 
+    virtual void PostLoad() override;
+
+
+    // --- Runtime Graph ---
+    // Compiled from ObjectiveArray in the editor and at cook, so the Subsystem never scans the array at runtime.
+
+    // Returns INDEX_NONE if the objective is not part of this mission.
+    int32 FindObjectiveIndex(FGameplayTag ObjectiveID) const { return RuntimeGraph.FindNode(ObjectiveID); }
+
+    const UMissionObjective* FindObjective(FGameplayTag ObjectiveID) const;
+
+    const UMissionObjective* GetObjectiveAt(int32 Index) const 
+        { return ObjectiveArray.IsValidIndex(Index) ? ObjectiveArray[Index].Get() : nullptr; }
+
+    const FMissionRuntimeGraph& GetRuntimeGraph() const { return RuntimeGraph; }
+
+    // Unique objectives in the mission. The mission completes once all of them are done.
+    int32 GetNumObjectives() const { return RuntimeGraph.GetNumObjectives(); }
+
+    // Rebuilds RuntimeGraph and the objectives' storage layouts. Returns false (and fills OutErrors) for dangling IDs or cycles.
+    bool CompileRuntimeGraph(TArray<FString>& OutErrors);
+
+    // Compiles the graph into the saved asset. Errors fail the cook.
+    virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
 
 #if WITH_EDITOR
     // Runs every time something is changed in the Editor
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
+    // Reports graph errors (dangling IDs, dependency cycles) to data validation
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
 #endif
 
+private:
+
+    UPROPERTY()
+    FMissionRuntimeGraph RuntimeGraph;
+
+    void BuildStorageLayouts();
+
 };
@@ -0,0 +1,204 @@
+// Periphery -- EvEGames -- MissionEventHistory.cpp
+
+#include "Missions/MissionEventHistory.h"
+#include "Missions/MissionStructs.h"
+#include "Missions/MissionLog.h"
+#include "Algo/BinarySearch.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+    // Bump when the binary layout changes
+    constexpr int32 EventHistoryFormatVersion = 1;
+}
+
+// ---------- Recording ----------
+
+int32 FMissionEventHistory::InternSource(const FGuid& SourceId)
+{
+    if (const int32* Found = SourceIndexById.Find(SourceId))
+    {
+        return *Found;
+    }
+
+    const int32 NewIndex = Sources.Add(SourceId);
+    SourceIndexById.Add(SourceId, NewIndex);
+    return NewIndex;
+}
+
+bool FMissionEventHistory::Record(FGameplayTag EventTag, const FGuid& SourceId)
+{
+    if (!EventTag.IsValid() || !SourceId.IsValid()) return false;
+
+    const int32 SourceIndex = InternSource(SourceId);
+    TArray<int32>& List = SourcesByTag.FindOrAdd(EventTag);
+
+    // New sources get the highest index, so this is almost always an append
+    const int32 Pos = Algo::LowerBound(List, SourceIndex);
+    if (List.IsValidIndex(Pos) && List[Pos] == SourceIndex) return false;
+
+    List.Insert(SourceIndex, Pos);
+    return true;
+}
+
+// ---------- Queries ----------
+
+int32 FMissionEventHistory::GetEventCount(FGameplayTag EventTag) const
+{
+    const TArray<int32>* List = SourcesByTag.Find(EventTag);
+    return List ? List->Num() : 0;
+}
+
+bool FMissionEventHistory::HasSourceDoneEvent(FGameplayTag EventTag, const FGuid& SourceId) const
+{
+    const int32* SourceIndex = SourceIndexById.Find(SourceId);
+    const TArray<int32>* List = SourcesByTag.Find(EventTag);
+    if (!SourceIndex || !List) return false;
+
+    return Algo::BinarySearch(*List, *SourceIndex) != INDEX_NONE;
+}
+
+void FMissionEventHistory::Reset()
+{
+    Sources.Reset();
+    SourceIndexById.Reset();
+    SourcesByTag.Reset();
+}
+
+// ---------- Save System ----------
+
+void FMissionEventHistory::Write(FArchive& Ar) const
+{
+    int32 Version = EventHistoryFormatVersion;
+    Ar << Version;
+
+    // 1. Source table
+    int32 NumSources = Sources.Num();
+    Ar << NumSources;
+    for (FGuid SourceId : Sources)
+    {
+        Ar << SourceId;
+    }
+
+    // 2. Per tag: name + delta-encoded sorted source indices
+    int32 NumTags = SourcesByTag.Num();
+    Ar << NumTags;
+
+    for (const TPair<FGameplayTag, TArray<int32>>& Pair : SourcesByTag)
+    {
+        FName TagName = Pair.Key.GetTagName();
+        Ar << TagName;
+
+        uint32 Count = Pair.Value.Num();
+        Ar.SerializeIntPacked(Count);
+
+        int32 Previous = 0;
+        for (const int32 SourceIndex : Pair.Value)
+        {
+            uint32 Delta = SourceIndex - Previous;
+            Ar.SerializeIntPacked(Delta);
+            Previous = SourceIndex;
+        }
+    }
+}
+
+void FMissionEventHistory::Read(FArchive& Ar)
+{
+    int32 Version = 0;
+    Ar << Version;
+    if (Version != EventHistoryFormatVersion)
+    {
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionEventHistory: Unknown format version %d. History discarded."), Version);
+        Ar.SetError();
+        return;
+    }
+
+    // 1. Source table
+    int32 NumSources = 0;
+    Ar << NumSources;
+    if (NumSources < 0 || Ar.IsError())
+    {
+        Ar.SetError();
+        return;
+    }
+
+    Sources.SetNum(NumSources);
+    SourceIndexById.Reserve(NumSources);
+    for (int32 i = 0; i < NumSources; i++)
+    {
+        Ar << Sources[i];
+        SourceIndexById.Add(Sources[i], i);
+    }
+
+    // 2. Per tag lists
+    int32 NumTags = 0;
+    Ar << NumTags;
+
+    for (int32 t = 0; t < NumTags && !Ar.IsError(); t++)
+    {
+        FName TagName;
+        Ar << TagName;
+
+        uint32 Count = 0;
+        Ar.SerializeIntPacked(Count);
+        if (Count > (uint32)NumSources)
+        {
+            Ar.SetError();
+            return;
+        }
+
+        TArray<int32> List;
+        List.Reserve(Count);
+
+        int32 Previous = 0;
+        for (uint32 i = 0; i < Count && !Ar.IsError(); i++)
+        {
+            uint32 Delta = 0;
+            Ar.SerializeIntPacked(Delta);
+            Previous += Delta;
+            List.Add(Previous);
+        }
+
+        // Tags removed from the project since the save are dropped
+        const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+        if (Tag.IsValid())
+        {
+            SourcesByTag.Add(Tag, MoveTemp(List));
+        }
+    }
+}
+
+void FMissionEventHistory::SaveToBytes(TArray<uint8>& OutBytes) const
+{
+    OutBytes.Reset();
+    FMemoryWriter Writer(OutBytes);
+    Write(Writer);
+}
+
+bool FMissionEventHistory::LoadFromBytes(const TArray<uint8>& Bytes)
+{
+    Reset();
+    if (Bytes.Num() == 0) return true;
+
+    FMemoryReader Reader(Bytes);
+    Read(Reader);
+
+    if (Reader.IsError())
+    {
+        Reset();
+        return false;
+    }
+    return true;
+}
+
+void FMissionEventHistory::ImportLegacy(const TMap<FGameplayTag, FActorSet>& LegacyHistory)
+{
+    for (const TPair<FGameplayTag, FActorSet>& Pair : LegacyHistory)
+    {
+        for (const FName& ActorName : Pair.Value.ActorNames)
+        {
+            Record(Pair.Key, FGuid::NewDeterministicGuid(ActorName.ToString()));
+        }
+    }
+}
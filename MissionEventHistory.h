@@ -0,0 +1,50 @@
+// Periphery -- EvEGames -- MissionEventHistory.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Which sources have emitted which mission events.
+ * Source ids are interned once into a table; each tag keeps a sorted array of source indices,
+ * so counts are O(1), membership is a binary search and the save format is a packed delta list.
+ */
+class INSIDETFV03_API FMissionEventHistory
+{
+public:
+
+	// Returns true if this source had not emitted this event before.
+	bool Record(FGameplayTag EventTag, const FGuid& SourceId);
+
+	// Number of unique sources that emitted EventTag.
+	int32 GetEventCount(FGameplayTag EventTag) const;
+
+	bool HasSourceDoneEvent(FGameplayTag EventTag, const FGuid& SourceId) const;
+
+	int32 GetNumTags() const { return SourcesByTag.Num(); }
+	int32 GetNumSources() const { return Sources.Num(); }
+
+	void Reset();
+
+	// --- Save System ---
+	void SaveToBytes(TArray<uint8>& OutBytes) const;
+	bool LoadFromBytes(const TArray<uint8>& Bytes);
+
+	// Import from the old name-keyed save layout. Only counts survive, names can't be mapped to source ids.
+	void ImportLegacy(const TMap<FGameplayTag, struct FActorSet>& LegacyHistory);
+
+private:
+
+	void Write(FArchive& Ar) const;
+	void Read(FArchive& Ar);
+
+	int32 InternSource(const FGuid& SourceId);
+
+	// Interned id table. Index = source index.
+	TArray<FGuid> Sources;
+	TMap<FGuid, int32> SourceIndexById;
+
+	// <EventTag, Sorted source indices>
+	TMap<FGameplayTag, TArray<int32>> SourcesByTag;
+};
@@ -0,0 +1,240 @@
+// Periphery -- EvEGames -- MissionEventRecorder.cpp
+
+#include "Missions/MissionEventRecorder.h"
+#include "Missions/MissionLog.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+    constexpr uint32 RecordingMagic = 0x504D5243; // 'PMRC'
+    constexpr int32 RecordingFormatVersion = 1;
+
+    // Tag table shared by all entries of a recording
+    struct FTagTable
+    {
+        TArray<FName> Names;
+        TMap<FName, uint32> IndexByName;
+
+        // 0 = no tag
+        uint32 Intern(FGameplayTag Tag)
+        {
+            if (!Tag.IsValid()) return 0;
+            const FName Name = Tag.GetTagName();
+            if (const uint32* Found = IndexByName.Find(Name)) return *Found;
+
+            Names.Add(Name);
+            return IndexByName.Add(Name, Names.Num());
+        }
+
+        FGameplayTag Resolve(uint32 Index) const
+        {
+            return Names.IsValidIndex(Index - 1) ? FGameplayTag::RequestGameplayTag(Names[Index - 1], false) : FGameplayTag();
+        }
+    };
+
+    void WriteRuntimeState(FArchive& Ar, const FMissionRuntimeState& MissionRt)
+    {
+        uint8 State = (uint8)MissionRt.MissionState;
+        int32 Remaining = MissionRt.RemainingObjectives;
+        Ar << State << Remaining;
+
+        TArray<FName> Completed;
+        for (const FGameplayTag& ID : MissionRt.CompletedObjectiveIDs) Completed.Add(ID.GetTagName());
+        Completed.Sort(FNameLexicalLess());
+        Ar << Completed;
+
+        TArray<FGameplayTag> ActiveIDs;
+        MissionRt.ActiveObjectives.GenerateKeyArray(ActiveIDs);
+        ActiveIDs.Sort([](const FGameplayTag& A, const FGameplayTag& B) { return A.GetTagName().LexicalLess(B.GetTagName()); });
+
+        int32 NumActive = ActiveIDs.Num();
+        Ar << NumActive;
+        for (const FGameplayTag& ID : ActiveIDs)
+        {
+            FObjectiveRuntimeState ObjRt = MissionRt.ActiveObjectives.FindChecked(ID);
+            FName Name = ID.GetTagName();
+            uint8 ObjState = (uint8)ObjRt.ObjectiveState;
+            Ar << Name << ObjState << ObjRt.IntSlots << ObjRt.FlagWords;
+
+            int32 NumSources = ObjRt.UniqueSources.Num();
+            Ar << NumSources;
+            for (FObjectiveSourceEntry& Source : ObjRt.UniqueSources)
+            {
+                Ar << Source.Slot << Source.SourceId;
+            }
+        }
+    }
+}
+
+// ---------- Recording ----------
+
+void FMissionEventRecorder::Start()
+{
+    FScopeLock Lock(&EntriesLock);
+    Entries.Reset();
+    StartTime = FPlatformTime::Seconds();
+}
+
+void FMissionEventRecorder::Add(FMissionRecordEntry Entry)
+{
+    Entry.Time = FPlatformTime::Seconds() - StartTime;
+
+    FScopeLock Lock(&EntriesLock);
+    Entries.Add(MoveTemp(Entry));
+}
+
+// ---------- File Format ----------
+
+bool FMissionEventRecorder::SaveToFile(const FString& FilePath, const TMap<FName, TArray<uint8>>& FinalState) const
+{
+    FTagTable Tags;
+    TArray<FGuid> Sources;
+    TMap<FGuid, uint32> SourceIndexById;
+
+    // 1. Entries: kind, time delta (us), tag / source indices, all packed
+    TArray<uint8> Body;
+    FMemoryWriter BodyWriter(Body);
+    {
+        FScopeLock Lock(&EntriesLock);
+
+        int32 NumEntries = Entries.Num();
+        BodyWriter << NumEntries;
+
+        uint64 PreviousMicros = 0;
+        for (const FMissionRecordEntry& Entry : Entries)
+        {
+            uint8 Kind = (uint8)Entry.Kind;
+            const uint64 Micros = (uint64)(Entry.Time * 1000000.0);
+            uint32 DeltaMicros = (uint32)FMath::Min<uint64>(Micros - FMath::Min(Micros, PreviousMicros), MAX_uint32);
+            PreviousMicros = Micros;
+
+            uint32 PrimaryIndex = Tags.Intern(Entry.PrimaryTag);
+            uint32 ObjectiveIndex = Tags.Intern(Entry.ObjectiveID);
+
+            // 0 = no source
+            uint32 SourceIndex = 0;
+            if (Entry.SourceId.IsValid())
+            {
+                if (const uint32* Found = SourceIndexById.Find(Entry.SourceId))
+                {
+                    SourceIndex = *Found;
+                }
+                else
+                {
+                    Sources.Add(Entry.SourceId);
+                    SourceIndex = SourceIndexById.Add(Entry.SourceId, Sources.Num());
+                }
+            }
+
+            uint32 Count = FMath::Max(Entry.Count, 0);
+            uint8 bSuccess = Entry.bSuccess ? 1 : 0;
+
+            BodyWriter << Kind;
+            BodyWriter.SerializeIntPacked(DeltaMicros);
+            BodyWriter.SerializeIntPacked(PrimaryIndex);
+            BodyWriter.SerializeIntPacked(ObjectiveIndex);
+            BodyWriter.SerializeIntPacked(SourceIndex);
+            BodyWriter.SerializeIntPacked(Count);
+            BodyWriter << bSuccess;
+        }
+    }
+
+    // 2. Header + tables, then entries, then the final state
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    uint32 Magic = RecordingMagic;
+    int32 Version = RecordingFormatVersion;
+    Writer << Magic << Version;
+    Writer << Tags.Names;
+    Writer << Sources;
+    Writer << Body;
+
+    TMap<FName, TArray<uint8>> State = FinalState;
+    Writer << State;
+
+    return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FMissionEventRecorder::LoadFromFile(const FString& FilePath, TArray<FMissionRecordEntry>& OutEntries, TMap<FName, TArray<uint8>>& OutFinalState)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        UE_LOG(LogPeripheryMission, Error, TEXT("MissionEventRecorder: Could not read %s"), *FilePath);
+        return false;
+    }
+
+    FMemoryReader Reader(Bytes);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Reader << Magic << Version;
+    if (Magic != RecordingMagic || Version != RecordingFormatVersion)
+    {
+        UE_LOG(LogPeripheryMission, Error, TEXT("MissionEventRecorder: %s is not a mission recording (version %d)"), *FilePath, Version);
+        return false;
+    }
+
+    FTagTable Tags;
+    TArray<FGuid> Sources;
+    TArray<uint8> Body;
+    Reader << Tags.Names;
+    Reader << Sources;
+    Reader << Body;
+    Reader << OutFinalState;
+    if (Reader.IsError()) return false;
+
+    FMemoryReader BodyReader(Body);
+    int32 NumEntries = 0;
+    BodyReader << NumEntries;
+
+    OutEntries.Reset(FMath::Max(NumEntries, 0));
+    double Time = 0.0;
+    for (int32 i = 0; i < NumEntries && !BodyReader.IsError(); i++)
+    {
+        uint8 Kind = 0, bSuccess = 0;
+        uint32 DeltaMicros = 0, PrimaryIndex = 0, ObjectiveIndex = 0, SourceIndex = 0, Count = 0;
+
+        BodyReader << Kind;
+        BodyReader.SerializeIntPacked(DeltaMicros);
+        BodyReader.SerializeIntPacked(PrimaryIndex);
+        BodyReader.SerializeIntPacked(ObjectiveIndex);
+        BodyReader.SerializeIntPacked(SourceIndex);
+        BodyReader.SerializeIntPacked(Count);
+        BodyReader << bSuccess;
+
+        Time += DeltaMicros / 1000000.0;
+
+        FMissionRecordEntry& Entry = OutEntries.AddDefaulted_GetRef();
+        Entry.Time = Time;
+        Entry.Kind = (EMissionRecordKind)Kind;
+        Entry.PrimaryTag = Tags.Resolve(PrimaryIndex);
+        Entry.ObjectiveID = Tags.Resolve(ObjectiveIndex);
+        Entry.SourceId = Sources.IsValidIndex((int32)SourceIndex - 1) ? Sources[SourceIndex - 1] : FGuid();
+        Entry.Count = (int32)Count;
+        Entry.bSuccess = bSuccess != 0;
+    }
+
+    return !BodyReader.IsError();
+}
+
+// ---------- State Snapshot ----------
+
+void FMissionEventRecorder::BuildStateSnapshot(const TMap<FGameplayTag, FMissionRuntimeState>& ActiveMissions,
+    const TMap<FGameplayTag, FMissionRuntimeState>& CompletedMissions, TMap<FName, TArray<uint8>>& OutSnapshot)
+{
+    OutSnapshot.Reset();
+
+    for (const TMap<FGameplayTag, FMissionRuntimeState>* Missions : { &ActiveMissions, &CompletedMissions })
+    {
+        for (const TPair<FGameplayTag, FMissionRuntimeState>& Pair : *Missions)
+        {
+            TArray<uint8>& Blob = OutSnapshot.Add(Pair.Key.GetTagName());
+            FMemoryWriter Writer(Blob);
+            WriteRuntimeState(Writer, Pair.Value);
+        }
+    }
+}
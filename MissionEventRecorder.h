@@ -0,0 +1,68 @@
+// Periphery -- EvEGames -- MissionEventRecorder.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Missions/MissionStructs.h"
+
+enum class EMissionRecordKind : uint8
+{
+	Event,
+	StartMission,
+	FinishMission,
+	ActivateObjective,
+	CompleteObjective
+};
+
+// One call into the mission subsystem.
+struct FMissionRecordEntry
+{
+	// Seconds since the recording started
+	double Time = 0.0;
+
+	EMissionRecordKind Kind = EMissionRecordKind::Event;
+
+	// EventTag for events, MissionID otherwise
+	FGameplayTag PrimaryTag;
+
+	// ObjectiveID for objective calls
+	FGameplayTag ObjectiveID;
+
+	// Source identity (see UMissionSubsystem::GetSourceId). Invalid for events without a source.
+	FGuid SourceId;
+
+	int32 Count = 1;
+	bool bSuccess = true;
+};
+
+/**
+ * Captures the mission call stream of a session into a compact binary log, so it can be replayed headless
+ * (see UMissionReplayCommandlet). Recordings are expected to start from a fresh mission state.
+ */
+class INSIDETFV03_API FMissionEventRecorder
+{
+public:
+
+	void Start();
+	void Add(FMissionRecordEntry Entry);
+
+	int32 Num() const { return Entries.Num(); }
+
+	// Writes the entries followed by the final mission state.
+	bool SaveToFile(const FString& FilePath, const TMap<FName, TArray<uint8>>& FinalState) const;
+
+	static bool LoadFromFile(const FString& FilePath, TArray<FMissionRecordEntry>& OutEntries, TMap<FName, TArray<uint8>>& OutFinalState);
+
+	// Stable per-mission encoding of the runtime state, used to verify replays.
+	static void BuildStateSnapshot(const TMap<FGameplayTag, FMissionRuntimeState>& ActiveMissions,
+		const TMap<FGameplayTag, FMissionRuntimeState>& CompletedMissions, TMap<FName, TArray<uint8>>& OutSnapshot);
+
+private:
+
+	double StartTime = 0.0;
+	TArray<FMissionRecordEntry> Entries;
+
+	// Events can be emitted from any thread
+	mutable FCriticalSection EntriesLock;
+};
@@ -0,0 +1,76 @@
+// Periphery -- EvEGames -- MissionExecutionContext.cpp
+
+#include "Missions/MissionExecutionContext.h"
+#include "Subsystems/ActorRegistrySubsystem.h"
+#include "Subsystems/MissionSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+// ---------- Query cache ----------
+
+void FMissionQueryCache::Validate(const UActorRegistrySubsystem& Registry)
+{
+    if (Frame == GFrameCounter && RegistryVersion == Registry.GetVersion()) return;
+
+    ActorsByTag.Reset();
+    FirstActorByTag.Reset();
+    Frame = GFrameCounter;
+    RegistryVersion = Registry.GetVersion();
+}
+
+TArray<AActor*> FMissionQueryCache::GetActors(const UActorRegistrySubsystem& Registry, FGameplayTag Tag)
+{
+    Validate(Registry);
+
+    if (const TArray<AActor*>* Found = ActorsByTag.Find(Tag))
+    {
+        return *Found;
+    }
+    return ActorsByTag.Add(Tag, Registry.GetActors(Tag));
+}
+
+AActor* FMissionQueryCache::FindActor(const UActorRegistrySubsystem& Registry, FGameplayTag Tag)
+{
+    Validate(Registry);
+
+    if (AActor* const* Found = FirstActorByTag.Find(Tag))
+    {
+        return *Found;
+    }
+    return FirstActorByTag.Add(Tag, Registry.FindActor(Tag));
+}
+
+void FMissionQueryCache::Reset()
+{
+    ActorsByTag.Reset();
+    FirstActorByTag.Reset();
+    Frame = MAX_uint64;
+}
+
+// ---------- Context ----------
+
+FMissionExecutionContext FMissionExecutionContext::FromActor(AActor* InContextActor)
+{
+    FMissionExecutionContext Context;
+    Context.ContextActor = InContextActor;
+    Context.World = InContextActor ? InContextActor->GetWorld() : nullptr;
+    Context.GameInstance = Context.World ? Context.World->GetGameInstance() : nullptr;
+    if (Context.GameInstance)
+    {
+        Context.MissionSubsystem = Context.GameInstance->GetSubsystem<UMissionSubsystem>();
+        Context.Registry = Context.GameInstance->GetSubsystem<UActorRegistrySubsystem>();
+    }
+    return Context;
+}
+
+TArray<AActor*> FMissionExecutionContext::GetActors(FGameplayTag Tag) const
+{
+    if (!Registry) return TArray<AActor*>();
+    return QueryCache ? QueryCache->GetActors(*Registry, Tag) : Registry->GetActors(Tag);
+}
+
+AActor* FMissionExecutionContext::FindActor(FGameplayTag Tag) const
+{
+    if (!Registry) return nullptr;
+    return QueryCache ? QueryCache->FindActor(*Registry, Tag) : Registry->FindActor(Tag);
+}
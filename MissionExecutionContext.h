@@ -0,0 +1,58 @@
+// Periphery -- EvEGames -- MissionExecutionContext.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class AActor;
+class UWorld;
+class UGameInstance;
+class UMissionSubsystem;
+class UActorRegistrySubsystem;
+
+/** Registry query results, memoized for one frame. Dropped when the frame or the registry's version changes. */
+class INSIDETFV03_API FMissionQueryCache
+{
+public:
+
+	TArray<AActor*> GetActors(const UActorRegistrySubsystem& Registry, FGameplayTag Tag);
+	AActor* FindActor(const UActorRegistrySubsystem& Registry, FGameplayTag Tag);
+
+	void Reset();
+
+private:
+
+	void Validate(const UActorRegistrySubsystem& Registry);
+
+	TMap<FGameplayTag, TArray<AActor*>> ActorsByTag;
+	TMap<FGameplayTag, AActor*> FirstActorByTag;
+
+	uint64 Frame = MAX_uint64;
+	uint32 RegistryVersion = 0;
+};
+
+/**
+ * What a mission action runs against. The Mission Subsystem resolves it once and shares the query cache
+ * between actions, so actions don't look up the pawn, subsystems or tagged actors themselves.
+ */
+struct INSIDETFV03_API FMissionExecutionContext
+{
+	// The actor the actions run for, usually the player pawn. May be null.
+	AActor* ContextActor = nullptr;
+
+	UWorld* World = nullptr;
+	UGameInstance* GameInstance = nullptr;
+	UMissionSubsystem* MissionSubsystem = nullptr;
+	UActorRegistrySubsystem* Registry = nullptr;
+
+	// Owned by the Mission Subsystem. Null for contexts made with FromActor.
+	FMissionQueryCache* QueryCache = nullptr;
+
+	// Resolves everything from the actor, without a shared query cache.
+	static FMissionExecutionContext FromActor(AActor* InContextActor);
+
+	// Registry GetActors (tag and its children) / FindActor (exact tag), memoized through QueryCache
+	TArray<AActor*> GetActors(FGameplayTag Tag) const;
+	AActor* FindActor(FGameplayTag Tag) const;
+};
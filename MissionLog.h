@@ -0,0 +1,20 @@
+// Periphery -- EvEGames -- MissionLog.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+// Test and Shipping compile out everything below Warning, tag formatting included.
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+INSIDETFV03_API DECLARE_LOG_CATEGORY_EXTERN(LogPeripheryMission, Warning, Warning);
+#else
+INSIDETFV03_API DECLARE_LOG_CATEGORY_EXTERN(LogPeripheryMission, Log, All);
+#endif
+
+// Unreal Insights counters for the mission path (compiled out with counter tracing)
+TRACE_DECLARE_INT_COUNTER_EXTERN(MissionEventsDelivered);
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(MissionEventsPerSecond);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MissionObjectivesTouched);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MissionCompletionChainDepth);
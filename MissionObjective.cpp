@@ -1,2 +1,7 @@
 #include "Missions/Objectives/MissionObjective.h"
 
+void UMissionObjective::InitializeRuntime(FObjectiveRuntimeState& RuntimeState) const
+{
+    RuntimeState.ObjectiveState = EProgressState::InProgress;
+    RuntimeState.InitializeStorage(StorageLayout);
+}
@@ -60,17 +60,62 @@ public:
 
     // --- Virtual API ---
 
-    virtual void InitializeRuntime(FObjectiveRuntimeState& RuntimeState) const 
-        { RuntimeState.ObjectiveState = EProgressState::InProgress; }
+    // Marks the objective InProgress and sizes its slot storage. Overrides must call Super.
+    virtual void InitializeRuntime(FObjectiveRuntimeState& RuntimeState) const;
 
+    /** Returns true if RuntimeState changed in any way (not only on completion): the Subsystem marks the mission for saving and checks IsComplete on it. */
     virtual bool OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, 
         AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const { return false; }
 
-    /** Called when ANY other objective in the mission is completed. */
+    /** Bulk variant of OnEvent: the same event happened Count times. Default forwards each occurrence to OnEvent. */
+    virtual bool OnEventCount(const FGameplayTag& MissionID, const FGameplayTag& EventTag, 
+        AActor* SourceActor, int32 Count, FObjectiveRuntimeState& RuntimeState) const
+    {
+        bool bChanged = false;
+        for (int32 i = 0; i < Count; i++)
+        {
+            bChanged |= OnEvent(MissionID, EventTag, SourceActor, RuntimeState);
+        }
+        return bChanged;
+    }
+
+    /** Called when an objective listed by GetRequiredObjectiveIDs is completed. */
     virtual bool OnObjectiveCompleted(const FGameplayTag& CompletedObjectiveID,
         FObjectiveRuntimeState& RuntimeState) const {    return false;  } 
 
     virtual bool IsComplete(const FObjectiveRuntimeState& RuntimeState) const { return false; }     // Child classes can override this for custom code-based completion checks
 
+    /** When true after an event or timer, the Subsystem fails the objective. */
+    virtual bool IsFailed(const FObjectiveRuntimeState& RuntimeState) const { return false; }
+
+    /** Seconds until OnTimerExpired, scheduled by the Subsystem on activation. 0 = no timer. */
+    virtual float GetTimeLimit() const { return 0.f; }
+
+    virtual bool OnTimerExpired(const FGameplayTag& MissionID, FObjectiveRuntimeState& RuntimeState) const { return false; }
+
+    /** Objectives whose completion this one waits on. Used to build the mission's reverse dependency graph. */
+    virtual void GetRequiredObjectiveIDs(TArray<FGameplayTag>& OutIDs) const {}
+
+    /** Event tags this objective reacts to. The Subsystem only routes events matching one of these (or a child tag) to OnEvent. */
+    virtual void GetListenedEventTags(TArray<FGameplayTag>& OutTags) const {}
+
+    /** True if OnEvent only accepts the listened tags themselves, so child tags aren't routed to it. */
+    virtual bool ListensExact() const { return false; }
+
+
+    // --- Storage Layout ---
+
+    /** Declares the int slots / flag bits this objective stores in FObjectiveRuntimeState. Called by UMissionData on load. */
+    virtual void BuildStorageLayout() { StorageLayout = FObjectiveStorageLayout(); }
+
+    const FObjectiveStorageLayout& GetStorageLayout() const { return StorageLayout; }
+
+    /** Copies progress from a pre-slot save (the legacy name-keyed maps) into freshly initialized slots. */
+    virtual void MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const {}
+
+protected:
+
+    FObjectiveStorageLayout StorageLayout;
+
 	
 };
\ No newline at end of file
@@ -0,0 +1,191 @@
+// Periphery -- EvEGames -- MissionReplayCommandlet.cpp
+
+#include "Commandlets/MissionReplayCommandlet.h"
+#include "Subsystems/MissionSubsystem.h"
+#include "Subsystems/ActorRegistrySubsystem.h"
+#include "Missions/MissionEventRecorder.h"
+#include "Missions/MissionLog.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Tickable.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    // Lets async loads and tickables (event queue, streamable callbacks) run
+    void PumpFrame(UWorld* World)
+    {
+        FlushAsyncLoading();
+        FTickableGameObject::TickObjects(World, LEVELTICK_All, false, 0.f);
+    }
+
+    const TCHAR* KindName(EMissionRecordKind Kind)
+    {
+        switch (Kind)
+        {
+        case EMissionRecordKind::Event:             return TEXT("Event");
+        case EMissionRecordKind::StartMission:      return TEXT("StartMission");
+        case EMissionRecordKind::FinishMission:     return TEXT("FinishMission");
+        case EMissionRecordKind::ActivateObjective: return TEXT("ActivateObjective");
+        case EMissionRecordKind::CompleteObjective: return TEXT("CompleteObjective");
+        }
+        return TEXT("?");
+    }
+}
+
+UMissionReplayCommandlet::UMissionReplayCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UMissionReplayCommandlet::Main(const FString& Params)
+{
+    FString LogPath;
+    if (!FParse::Value(*Params, TEXT("Log="), LogPath))
+    {
+        UE_LOG(LogPeripheryMission, Error, TEXT("MissionReplay: Usage: -run=MissionReplay -Log=<file.pmrec>"));
+        return 1;
+    }
+
+    TArray<FMissionRecordEntry> Entries;
+    TMap<FName, TArray<uint8>> ExpectedState;
+    if (!FMissionEventRecorder::LoadFromFile(LogPath, Entries, ExpectedState)) return 1;
+
+    // 1. Fresh game instance, world and subsystems
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+    GameInstance->InitializeStandalone();
+    UWorld* World = GameInstance->GetWorld();
+
+    UMissionSubsystem* MissionSys = GameInstance->GetSubsystem<UMissionSubsystem>();
+    UActorRegistrySubsystem* Registry = GameInstance->GetSubsystem<UActorRegistrySubsystem>();
+    if (!World || !MissionSys || !Registry)
+    {
+        UE_LOG(LogPeripheryMission, Error, TEXT("MissionReplay: Could not create the game instance"));
+        return 1;
+    }
+
+    // 2. One proxy actor per recorded source, so source ids resolve the same way
+    TMap<FGuid, AActor*> Proxies;
+    for (const FMissionRecordEntry& Entry : Entries)
+    {
+        if (!Entry.SourceId.IsValid() || Proxies.Contains(Entry.SourceId)) continue;
+
+        AActor* Proxy = World->SpawnActor<AActor>();
+        Registry->RegisterSaveableActor(Proxy, Entry.SourceId);
+        Proxies.Add(Entry.SourceId, Proxy);
+    }
+
+    UE_LOG(LogPeripheryMission, Display, TEXT("MissionReplay: %d entries over %.2fs, %d sources"),
+        Entries.Num(), Entries.Num() > 0 ? Entries.Last().Time : 0.0, Proxies.Num());
+
+    // 3. Feed the recording, timing each call
+    TArray<double> LatenciesUs;
+    LatenciesUs.Reserve(Entries.Num());
+
+    constexpr int32 NumBuckets = 24;
+    int32 Histogram[NumBuckets] = {};
+
+    for (const FMissionRecordEntry& Entry : Entries)
+    {
+        AActor* Source = Entry.SourceId.IsValid() ? Proxies.FindRef(Entry.SourceId) : nullptr;
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        switch (Entry.Kind)
+        {
+        case EMissionRecordKind::Event:
+            {
+                FMissionEventRecord Record;
+                Record.EventTag = Entry.PrimaryTag;
+                Record.SourceActor = Source;
+                Record.Count = Entry.Count;
+                MissionSys->EmitActorEvents(MakeArrayView(&Record, 1));
+            }
+            break;
+        case EMissionRecordKind::StartMission:
+            MissionSys->StartMission(Entry.PrimaryTag);
+            break;
+        case EMissionRecordKind::FinishMission:
+            MissionSys->FinishMission(Entry.PrimaryTag, Entry.bSuccess);
+            break;
+        case EMissionRecordKind::ActivateObjective:
+            MissionSys->ActivateObjective(Entry.PrimaryTag, Entry.ObjectiveID);
+            break;
+        case EMissionRecordKind::CompleteObjective:
+            MissionSys->CompleteObjective(Entry.PrimaryTag, Entry.ObjectiveID, Entry.bSuccess);
+            break;
+        }
+        const double Us = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+
+        LatenciesUs.Add(Us);
+        Histogram[FMath::Clamp((int32)FMath::FloorLog2((uint32)FMath::Max(Us, 1.0)), 0, NumBuckets - 1)]++;
+
+        // Missions start once their asset is in; later entries depend on it
+        if (Entry.Kind == EMissionRecordKind::StartMission)
+        {
+            for (int32 Frame = 0; Frame < 100 && !MissionSys->IsMissionActive(Entry.PrimaryTag)
+                && !MissionSys->CompletedMissions.Contains(Entry.PrimaryTag); Frame++)
+            {
+                PumpFrame(World);
+            }
+        }
+    }
+
+    MissionSys->FlushQueuedEvents();
+    PumpFrame(World);
+
+    // 4. Latency report
+    if (LatenciesUs.Num() > 0)
+    {
+        LatenciesUs.Sort();
+        auto Percentile = [&LatenciesUs](double P) { return LatenciesUs[FMath::Min((int32)(P * LatenciesUs.Num()), LatenciesUs.Num() - 1)]; };
+
+        UE_LOG(LogPeripheryMission, Display, TEXT("MissionReplay: Latency p50 %.1fus  p90 %.1fus  p99 %.1fus  max %.1fus"),
+            Percentile(0.5), Percentile(0.9), Percentile(0.99), LatenciesUs.Last());
+
+        for (int32 b = 0; b < NumBuckets; b++)
+        {
+            if (Histogram[b] == 0) continue;
+            UE_LOG(LogPeripheryMission, Display, TEXT("  < %8u us : %d"), 1u << (b + 1), Histogram[b]);
+        }
+
+        TMap<EMissionRecordKind, int32> KindCounts;
+        for (const FMissionRecordEntry& Entry : Entries) KindCounts.FindOrAdd(Entry.Kind)++;
+        for (const TPair<EMissionRecordKind, int32>& Pair : KindCounts)
+        {
+            UE_LOG(LogPeripheryMission, Display, TEXT("  %-18s x%d"), KindName(Pair.Key), Pair.Value);
+        }
+    }
+
+    // 5. Verify the final state
+    TMap<FName, TArray<uint8>> ReplayedState;
+    FMissionEventRecorder::BuildStateSnapshot(MissionSys->ActiveMissions, MissionSys->CompletedMissions, ReplayedState);
+
+    int32 Mismatches = 0;
+    for (const TPair<FName, TArray<uint8>>& Pair : ExpectedState)
+    {
+        const TArray<uint8>* Replayed = ReplayedState.Find(Pair.Key);
+        if (!Replayed || *Replayed != Pair.Value)
+        {
+            UE_LOG(LogPeripheryMission, Error, TEXT("MissionReplay: MISMATCH %s (%s)"), *Pair.Key.ToString(),
+                Replayed ? TEXT("different state") : TEXT("missing after replay"));
+            Mismatches++;
+        }
+    }
+    for (const TPair<FName, TArray<uint8>>& Pair : ReplayedState)
+    {
+        if (!ExpectedState.Contains(Pair.Key))
+        {
+            UE_LOG(LogPeripheryMission, Error, TEXT("MissionReplay: MISMATCH %s (not in recording)"), *Pair.Key.ToString());
+            Mismatches++;
+        }
+    }
+
+    UE_LOG(LogPeripheryMission, Display, TEXT("MissionReplay: %s, %d mismatches across %d recorded missions"),
+        Mismatches == 0 ? TEXT("PASSED") : TEXT("FAILED"), Mismatches, ExpectedState.Num());
+
+    GameInstance->Shutdown();
+    return Mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+// Periphery -- EvEGames -- MissionReplayCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MissionReplayCommandlet.generated.h"
+
+/**
+ * Replays a mission recording (Periphery.Mission.Record.Start / Stop) into a fresh Mission Subsystem.
+ * Recorded sources are stood in for by proxy actors registered under their recorded Guids.
+ * Reports per-call latency and verifies the final mission state against the recording.
+ *
+ * UnrealEditor-Cmd.exe InsideTFv03.uproject -run=MissionReplay -Log=<file.pmrec> -nullrhi
+ */
+UCLASS()
+class INSIDETFV03_API UMissionReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UMissionReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,181 @@
+// Periphery -- EvEGames -- MissionRuntimeGraph.cpp
+
+#include "Missions/MissionRuntimeGraph.h"
+#include "Missions/Objectives/MissionObjective.h"
+
+namespace
+{
+    template<typename T>
+    TArrayView<const T> MakeRange(const TArray<T>& Flat, int32 First, int32 Count)
+    {
+        return (Count > 0 && Flat.IsValidIndex(First + Count - 1)) ? TArrayView<const T>(Flat.GetData() + First, Count) : TArrayView<const T>();
+    }
+}
+
+// ---------- Compile ----------
+
+bool FMissionRuntimeGraph::Compile(const TArray<TObjectPtr<UMissionObjective>>& Objectives, FMissionRuntimeGraph& OutGraph, TArray<FString>& OutErrors)
+{
+    const int32 NumErrorsBefore = OutErrors.Num();
+    const int32 Num = Objectives.Num();
+
+    OutGraph = FMissionRuntimeGraph();
+    OutGraph.Nodes.SetNum(Num);
+
+    // 1. Identity
+    for (int32 i = 0; i < Num; i++)
+    {
+        const UMissionObjective* Obj = Objectives[i];
+        if (!Obj)
+        {
+            OutErrors.Add(FString::Printf(TEXT("Objective %d is empty."), i));
+            continue;
+        }
+        if (!Obj->ObjectiveID.IsValid())
+        {
+            OutErrors.Add(FString::Printf(TEXT("Objective %d (%s) has no ObjectiveID."), i, *Obj->Name.ToString()));
+            continue;
+        }
+        if (OutGraph.NodeIndexByID.Contains(Obj->ObjectiveID))
+        {
+            OutErrors.Add(FString::Printf(TEXT("Duplicate ObjectiveID %s (objective %d). Only the first is reachable."), *Obj->ObjectiveID.ToString(), i));
+            continue;
+        }
+
+        OutGraph.NodeIndexByID.Add(Obj->ObjectiveID, i);
+        OutGraph.Nodes[i].ObjectiveID = Obj->ObjectiveID;
+    }
+
+    // 2. Next edges, listened tags, dependencies
+    TArray<TArray<int32>> Dependents;
+    Dependents.SetNum(Num);
+
+    TArray<FGameplayTag> Scratch;
+    for (int32 i = 0; i < Num; i++)
+    {
+        FMissionGraphNode& Node = OutGraph.Nodes[i];
+        Node.FirstNext = OutGraph.NextNodes.Num();
+        Node.FirstListenedTag = OutGraph.ListenedTags.Num();
+
+        const UMissionObjective* Obj = Objectives[i];
+        if (!Obj || !Node.ObjectiveID.IsValid()) continue;
+
+        for (const FGameplayTag& NextID : Obj->NextObjectiveIDs)
+        {
+            const int32 NextIndex = OutGraph.FindNode(NextID);
+            if (NextIndex == INDEX_NONE)
+            {
+                OutErrors.Add(FString::Printf(TEXT("%s activates unknown objective %s."), *Node.ObjectiveID.ToString(), *NextID.ToString()));
+                continue;
+            }
+            OutGraph.NextNodes.Add(NextIndex);
+        }
+        Node.NumNext = OutGraph.NextNodes.Num() - Node.FirstNext;
+
+        Scratch.Reset();
+        Obj->GetListenedEventTags(Scratch);
+        for (int32 TagIndex = 0; TagIndex < Scratch.Num(); TagIndex++)
+        {
+            const FGameplayTag& Tag = Scratch[TagIndex];
+            if (Tag.IsValid() && !MakeArrayView(Scratch.GetData(), TagIndex).Contains(Tag))
+            {
+                OutGraph.ListenedTags.Add(Tag);
+            }
+        }
+        Node.NumListenedTags = OutGraph.ListenedTags.Num() - Node.FirstListenedTag;
+        Node.bListensExact = Obj->ListensExact();
+        Node.bAutoStart = Obj->bStartAutomatically;
+        if (Node.bAutoStart)
+        {
+            OutGraph.AutoStartNodes.Add(i);
+        }
+
+        Scratch.Reset();
+        Obj->GetRequiredObjectiveIDs(Scratch);
+        for (const FGameplayTag& RequiredID : Scratch)
+        {
+            const int32 RequiredIndex = OutGraph.FindNode(RequiredID);
+            if (RequiredIndex == INDEX_NONE)
+            {
+                OutErrors.Add(FString::Printf(TEXT("%s waits on unknown objective %s."), *Node.ObjectiveID.ToString(), *RequiredID.ToString()));
+                continue;
+            }
+            if (RequiredIndex == i)
+            {
+                OutErrors.Add(FString::Printf(TEXT("%s waits on itself."), *Node.ObjectiveID.ToString()));
+                continue;
+            }
+            Dependents[RequiredIndex].AddUnique(i);
+        }
+    }
+
+    // 3. Gatekeeper cycles never complete. Kahn's algorithm: whatever is never freed is on (or behind) a cycle.
+    TArray<int32> NumWaitingOn;
+    NumWaitingOn.SetNumZeroed(Num);
+    for (const TArray<int32>& List : Dependents)
+    {
+        for (const int32 Dependent : List) NumWaitingOn[Dependent]++;
+    }
+
+    TArray<int32> Ready;
+    for (int32 i = 0; i < Num; i++)
+    {
+        if (NumWaitingOn[i] == 0) Ready.Add(i);
+    }
+    for (int32 Head = 0; Head < Ready.Num(); Head++)
+    {
+        for (const int32 Dependent : Dependents[Ready[Head]])
+        {
+            if (--NumWaitingOn[Dependent] == 0) Ready.Add(Dependent);
+        }
+    }
+    if (Ready.Num() < Num)
+    {
+        for (int32 i = 0; i < Num; i++)
+        {
+            if (NumWaitingOn[i] == 0) continue;
+
+            OutErrors.Add(FString::Printf(TEXT("%s is in, or waits on, a dependency cycle and can never complete."), *OutGraph.Nodes[i].ObjectiveID.ToString()));
+
+            // Cut its incoming edges so the runtime never waits on the cycle
+            for (TArray<int32>& List : Dependents) List.Remove(i);
+        }
+    }
+
+    for (int32 i = 0; i < Num; i++)
+    {
+        FMissionGraphNode& Node = OutGraph.Nodes[i];
+        Node.FirstDependent = OutGraph.DependentNodes.Num();
+        Node.NumDependents = Dependents[i].Num();
+        OutGraph.DependentNodes.Append(Dependents[i]);
+    }
+
+    OutGraph.Version = CompilerVersion;
+    return OutErrors.Num() == NumErrorsBefore;
+}
+
+// ---------- Queries ----------
+
+int32 FMissionRuntimeGraph::FindNode(FGameplayTag ObjectiveID) const
+{
+    const int32* Found = NodeIndexByID.Find(ObjectiveID);
+    return Found ? *Found : INDEX_NONE;
+}
+
+TArrayView<const int32> FMissionRuntimeGraph::GetNextNodes(int32 Index) const
+{
+    const FMissionGraphNode* Node = GetNode(Index);
+    return Node ? MakeRange(NextNodes, Node->FirstNext, Node->NumNext) : TArrayView<const int32>();
+}
+
+TArrayView<const int32> FMissionRuntimeGraph::GetDependentNodes(int32 Index) const
+{
+    const FMissionGraphNode* Node = GetNode(Index);
+    return Node ? MakeRange(DependentNodes, Node->FirstDependent, Node->NumDependents) : TArrayView<const int32>();
+}
+
+TArrayView<const FGameplayTag> FMissionRuntimeGraph::GetListenedTags(int32 Index) const
+{
+    const FMissionGraphNode* Node = GetNode(Index);
+    return Node ? MakeRange(ListenedTags, Node->FirstListenedTag, Node->NumListenedTags) : TArrayView<const FGameplayTag>();
+}
@@ -0,0 +1,104 @@
+// Periphery -- EvEGames -- MissionRuntimeGraph.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "MissionRuntimeGraph.generated.h"
+
+class UMissionObjective;
+
+/** One objective of a compiled mission. Ranges index into the flat arrays of FMissionRuntimeGraph. */
+USTRUCT()
+struct FMissionGraphNode
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag ObjectiveID;
+
+	// Objectives activated when this one succeeds
+	UPROPERTY()
+	int32 FirstNext = 0;
+
+	UPROPERTY()
+	int32 NumNext = 0;
+
+	// Objectives (Gatekeepers) waiting on this one
+	UPROPERTY()
+	int32 FirstDependent = 0;
+
+	UPROPERTY()
+	int32 NumDependents = 0;
+
+	UPROPERTY()
+	int32 FirstListenedTag = 0;
+
+	UPROPERTY()
+	int32 NumListenedTags = 0;
+
+	UPROPERTY()
+	bool bAutoStart = false;
+
+	UPROPERTY()
+	bool bListensExact = false;
+};
+
+/**
+ * Flat, immutable form of a mission's objectives, compiled in the editor / at cook and saved with the asset.
+ * Node i is ObjectiveArray[i]. All objective references are resolved to node indices.
+ */
+USTRUCT()
+struct INSIDETFV03_API FMissionRuntimeGraph
+{
+	GENERATED_BODY()
+
+	// Bump when the compiled layout or rules change, so older graphs are recompiled on load.
+	static constexpr int32 CompilerVersion = 1;
+
+	// Compiles Objectives into OutGraph. Problems are added to OutErrors; the graph skips what they affect.
+	// Returns false if there were any.
+	static bool Compile(const TArray<TObjectPtr<UMissionObjective>>& Objectives, FMissionRuntimeGraph& OutGraph, TArray<FString>& OutErrors);
+
+	bool IsCompiled() const { return Version == CompilerVersion; }
+
+	int32 Num() const { return Nodes.Num(); }
+
+	// Unique objectives. The mission completes once all of them are done.
+	int32 GetNumObjectives() const { return NodeIndexByID.Num(); }
+
+	// Returns INDEX_NONE if the objective is not part of the mission.
+	int32 FindNode(FGameplayTag ObjectiveID) const;
+
+	const FMissionGraphNode* GetNode(int32 Index) const { return Nodes.IsValidIndex(Index) ? &Nodes[Index] : nullptr; }
+
+	TArrayView<const int32> GetNextNodes(int32 Index) const;
+	TArrayView<const int32> GetDependentNodes(int32 Index) const;
+	TArrayView<const FGameplayTag> GetListenedTags(int32 Index) const;
+
+	const TArray<int32>& GetAutoStartNodes() const { return AutoStartNodes; }
+
+private:
+
+	UPROPERTY()
+	int32 Version = 0;
+
+	UPROPERTY()
+	TArray<FMissionGraphNode> Nodes;
+
+	UPROPERTY()
+	TArray<int32> NextNodes;
+
+	UPROPERTY()
+	TArray<int32> DependentNodes;
+
+	UPROPERTY()
+	TArray<FGameplayTag> ListenedTags;
+
+	UPROPERTY()
+	TArray<int32> AutoStartNodes;
+
+	// First node with each ID
+	UPROPERTY()
+	TMap<FGameplayTag, int32> NodeIndexByID;
+};
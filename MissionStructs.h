@@ -3,6 +3,10 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/PropertyTag.h"
+#include "Missions/MissionTimerWheel.h"
 #include "MissionStructs.generated.h"
 
 
@@ -35,6 +39,45 @@ struct FObjectiveStepRuntimeState
 	bool bStepCompleted = false;
 };
 
+// Storage schema written into FObjectiveRuntimeState::StorageVersion.
+// Older states (0 = name-keyed maps, see FLegacyObjectiveRuntimeState) are migrated by
+// UMissionObjective::MigrateLegacyStorage when a save is loaded.
+namespace ObjectiveStorageVersion
+{
+    constexpr int32 Slots = 1;
+    constexpr int32 Latest = Slots;
+}
+
+// Fixed storage an objective needs, declared once when its mission asset loads.
+struct FObjectiveStorageLayout
+{
+    int32 NumInts = 0;
+    int32 NumFlags = 0;
+};
+
+// A source actor that was already counted for a given int slot.
+USTRUCT(BlueprintType)
+struct FObjectiveSourceEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(SaveGame)
+    int32 Slot = 0;
+
+    // Stable actor id (see UMissionSubsystem::ResolveSourceId)
+    UPROPERTY(SaveGame)
+    FGuid SourceId;
+
+    bool operator<(const FObjectiveSourceEntry& Other) const
+    {
+        return Slot != Other.Slot ? Slot < Other.Slot : SourceId < Other.SourceId;
+    }
+    bool operator==(const FObjectiveSourceEntry& Other) const
+    {
+        return Slot == Other.Slot && SourceId == Other.SourceId;
+    }
+};
+
 USTRUCT(BlueprintType)
 struct FObjectiveRuntimeState
 {
@@ -47,23 +90,82 @@ struct FObjectiveRuntimeState
     UPROPERTY(BlueprintReadWrite, SaveGame)
     EProgressState ObjectiveState = EProgressState::NotStarted;
 
-    // --- (Generic Storage) ---
-    
+    UPROPERTY(SaveGame)
+    int32 StorageVersion = 0;
+
+    // --- (Slot Storage) ---
+    // Laid out by the objective's FObjectiveStorageLayout. Each objective class documents its slots.
+
     // Counters (Kill counts, Steps completed index, Items collected)
-    UPROPERTY(BlueprintReadWrite, SaveGame)
-    TMap<FName, int32> IntStorage;
+    UPROPERTY(BlueprintReadOnly, SaveGame)
+    TArray<int32> IntSlots;
 
-    // Flags (IsTimerRunning, HasVisitedLocation, Step_A_Done)
-    UPROPERTY(BlueprintReadWrite, SaveGame)
-    TMap<FName, bool> BoolStorage;
+    // Flags (Checklist entries, Gatekeeper requirements), 32 per word
+    UPROPERTY(SaveGame)
+    TArray<uint32> FlagWords;
 
-    // Analog Data (Time remaining, Distance traveled, Percent complete)
-    UPROPERTY(BlueprintReadWrite, SaveGame)
-    TMap<FName, float> FloatStorage;
+    // History (Unique sources already counted), sorted
+    UPROPERTY(SaveGame)
+    TArray<FObjectiveSourceEntry> UniqueSources;
 
-    // History (Unique Actor IDs seen, specific choices made)
-    UPROPERTY(BlueprintReadWrite, SaveGame)
-    TSet<FString> StringStorage;
+    // Time limit timer (see UMissionObjective::GetTimeLimit). Runtime only, saved as an FMissionTimerRecord.
+    FMissionTimerHandle DeadlineTimer;
+
+    void InitializeStorage(const FObjectiveStorageLayout& Layout)
+    {
+        StorageVersion = ObjectiveStorageVersion::Latest;
+        IntSlots.Init(0, Layout.NumInts);
+        FlagWords.Init(0, FMath::DivideAndRoundUp(Layout.NumFlags, 32));
+        UniqueSources.Reset();
+    }
+
+    // Keeps existing values but grows/shrinks to the layout (the asset changed since this state was saved).
+    // Returns true if the storage had to change.
+    bool ConformStorage(const FObjectiveStorageLayout& Layout)
+    {
+        const int32 NumWords = FMath::DivideAndRoundUp(Layout.NumFlags, 32);
+        if (IntSlots.Num() == Layout.NumInts && FlagWords.Num() == NumWords) return false;
+
+        IntSlots.SetNumZeroed(Layout.NumInts);
+        FlagWords.SetNumZeroed(NumWords);
+        return true;
+    }
+
+    int32 GetInt(int32 Slot) const { return IntSlots.IsValidIndex(Slot) ? IntSlots[Slot] : 0; }
+    void SetInt(int32 Slot, int32 Value) { if (IntSlots.IsValidIndex(Slot)) IntSlots[Slot] = Value; }
+    void AddInt(int32 Slot, int32 Delta) { if (IntSlots.IsValidIndex(Slot)) IntSlots[Slot] += Delta; }
+
+    bool GetFlag(int32 Bit) const
+    {
+        const int32 Word = Bit >> 5;
+        return FlagWords.IsValidIndex(Word) && (FlagWords[Word] & (1u << (Bit & 31))) != 0;
+    }
+
+    // Returns true if the flag was not already set
+    bool SetFlag(int32 Bit)
+    {
+        const int32 Word = Bit >> 5;
+        if (!FlagWords.IsValidIndex(Word)) return false;
+
+        const uint32 Mask = 1u << (Bit & 31);
+        const bool bWasSet = (FlagWords[Word] & Mask) != 0;
+        FlagWords[Word] |= Mask;
+        return !bWasSet;
+    }
+
+    // Returns true if SourceId had not been counted for Slot yet
+    bool AddUniqueSource(int32 Slot, const FGuid& SourceId)
+    {
+        FObjectiveSourceEntry Entry;
+        Entry.Slot = Slot;
+        Entry.SourceId = SourceId;
+
+        const int32 Index = Algo::LowerBound(UniqueSources, Entry);
+        if (UniqueSources.IsValidIndex(Index) && UniqueSources[Index] == Entry) return false;
+
+        UniqueSources.Insert(Entry, Index);
+        return true;
+    }
 };
 
 USTRUCT(BlueprintType)
@@ -82,6 +184,192 @@ struct FMissionRuntimeState
 
 	UPROPERTY(BlueprintReadWrite, Category="Runtime")
 	TSet<FGameplayTag> CompletedObjectiveIDs; 
+
+	// Objectives of the mission asset not yet in CompletedObjectiveIDs. The mission is done at 0.
+	UPROPERTY(BlueprintReadOnly, Category="Runtime")
+	int32 RemainingObjectives = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Runtime")
+	int32 TotalObjectives = 0;
+
+	// 0..1, for the HUD
+	float GetProgress() const
+	{
+		return TotalObjectives > 0 ? 1.f - (float)RemainingObjectives / TotalObjectives : 0.f;
+	}
+};
+
+// --- Legacy saves (MissionSaveVersion 0) ---
+// Load-only mirrors of the runtime structs as they were saved, so the old name-keyed maps
+// never ride along in live states or delta saves. Property names must match the old ones.
+
+namespace MissionLegacySave
+{
+	// The save was written with the runtime struct: same property names, so read it as the mirror
+	inline bool SerializeMirror(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot, UScriptStruct* Mirror, const UScriptStruct* Runtime, void* Data)
+	{
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+		const FName SavedStruct = Tag.StructName;
+#else
+		const FName SavedStruct = Tag.GetType().GetParameterName(0);
+#endif
+		if (Tag.Type != NAME_StructProperty || SavedStruct != Runtime->GetFName()) return false;
+
+		Mirror->SerializeItem(Slot, Data, nullptr);
+		return true;
+	}
+}
+
+USTRUCT()
+struct FLegacyObjectiveRuntimeState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame)
+	FGameplayTag ObjectiveID;
+
+	UPROPERTY(SaveGame)
+	EProgressState ObjectiveState = EProgressState::NotStarted;
+
+	UPROPERTY(SaveGame)
+	int32 StorageVersion = 0;
+
+	// Slot storage (StorageVersion 1)
+	UPROPERTY(SaveGame)
+	TArray<int32> IntSlots;
+
+	UPROPERTY(SaveGame)
+	TArray<uint32> FlagWords;
+
+	UPROPERTY(SaveGame)
+	TArray<FObjectiveSourceEntry> UniqueSources;
+
+	// Name-keyed storage (StorageVersion 0), only read by UMissionObjective::MigrateLegacyStorage
+	UPROPERTY(SaveGame)
+	TMap<FName, int32> IntStorage;
+
+	UPROPERTY(SaveGame)
+	TMap<FName, bool> BoolStorage;
+
+	UPROPERTY(SaveGame)
+	TMap<FName, float> FloatStorage;
+
+	UPROPERTY(SaveGame)
+	TSet<FString> StringStorage;
+
+	bool SerializeFromMismatchedTag(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot)
+	{
+		return MissionLegacySave::SerializeMirror(Tag, Slot, StaticStruct(), FObjectiveRuntimeState::StaticStruct(), this);
+	}
+
+	// Everything but the name-keyed maps
+	FObjectiveRuntimeState ToRuntimeState() const
+	{
+		FObjectiveRuntimeState State;
+		State.ObjectiveID = ObjectiveID;
+		State.ObjectiveState = ObjectiveState;
+		State.StorageVersion = StorageVersion;
+		State.IntSlots = IntSlots;
+		State.FlagWords = FlagWords;
+		State.UniqueSources = UniqueSources;
+		return State;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FLegacyObjectiveRuntimeState> : public TStructOpsTypeTraitsBase2<FLegacyObjectiveRuntimeState>
+{
+	enum { WithStructuredSerializeFromMismatchedTag = true };
+};
+
+USTRUCT()
+struct FLegacyMissionRuntimeState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame)
+	FGameplayTag MissionID;
+
+	UPROPERTY(SaveGame)
+	EProgressState MissionState = EProgressState::NotStarted;
+
+	UPROPERTY(SaveGame)
+	TMap<FGameplayTag, FLegacyObjectiveRuntimeState> ActiveObjectives;
+
+	UPROPERTY(SaveGame)
+	TSet<FGameplayTag> CompletedObjectiveIDs;
+
+	// Recomputed from the asset on load (UMissionSubsystem::InitializeCompletionCounter)
+	UPROPERTY(SaveGame)
+	int32 RemainingObjectives = 0;
+
+	UPROPERTY(SaveGame)
+	int32 TotalObjectives = 0;
+
+	bool SerializeFromMismatchedTag(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot)
+	{
+		return MissionLegacySave::SerializeMirror(Tag, Slot, StaticStruct(), FMissionRuntimeState::StaticStruct(), this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FLegacyMissionRuntimeState> : public TStructOpsTypeTraitsBase2<FLegacyMissionRuntimeState>
+{
+	enum { WithStructuredSerializeFromMismatchedTag = true };
+};
+
+// A pending mission timer in the save. Remaining time is stored, so saving pauses it.
+USTRUCT()
+struct FMissionTimerRecord
+{
+	GENERATED_BODY()
+
+	// EMissionTimerKind
+	UPROPERTY(SaveGame)
+	uint8 Kind = 0;
+
+	UPROPERTY(SaveGame)
+	FGameplayTag MissionID;
+
+	UPROPERTY(SaveGame)
+	FGameplayTag ObjectiveID;
+
+	// DelayedAction: the instanced action inside its mission asset
+	UPROPERTY(SaveGame)
+	FSoftObjectPath Action;
+
+	UPROPERTY(SaveGame)
+	float RemainingSeconds = 0.f;
+};
+
+// An active mission in the save: its FMissionRuntimeState, serialized on its own so unchanged missions are reused.
+USTRUCT()
+struct FMissionSaveRecord
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame)
+	FGameplayTag MissionID;
+
+	UPROPERTY(SaveGame)
+	TArray<uint8> StateData;
+};
+
+// A single (or repeated) event on the mission event bus.
+USTRUCT(BlueprintType)
+struct FMissionEventRecord
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category="Event")
+    FGameplayTag EventTag;
+
+    UPROPERTY(BlueprintReadWrite, Category="Event")
+    TWeakObjectPtr<AActor> SourceActor;
+
+    // How many times this event happened (coalesced/bulk events)
+    UPROPERTY(BlueprintReadWrite, Category="Event")
+    int32 Count = 1;
 };
 
 USTRUCT(BlueprintType)
@@ -1,10 +1,200 @@
 // MissionSubsystem.cpp
 
 #include "Subsystems/MissionSubsystem.h"
+#include "Missions/PeripheryMissionSettings.h"
+#include "Missions/MissionLog.h"
 #include "Core/PeripherySaveGame.h"
+#include "Subsystems/ActorRegistrySubsystem.h"
+#include "Missions/Actions/MissionAction.h"
 #include "Engine/AssetManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/OutputDeviceNull.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectHash.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+DEFINE_LOG_CATEGORY(LogPeripheryMission);
+
+TRACE_DECLARE_INT_COUNTER(MissionEventsDelivered, TEXT("Mission/EventsDelivered"));
+TRACE_DECLARE_FLOAT_COUNTER(MissionEventsPerSecond, TEXT("Mission/EventsPerSecond"));
+TRACE_DECLARE_INT_COUNTER(MissionObjectivesTouched, TEXT("Mission/ObjectivesTouched"));
+TRACE_DECLARE_INT_COUNTER(MissionCompletionChainDepth, TEXT("Mission/CompletionChainDepth"));
+
+namespace
+{
+    // ---------- Save encoding ----------
+
+    constexpr uint8 CompletedArchiveVersion = 1;
+
+    // Tagged serialization, so states saved before a struct change still load
+    void WriteMissionState(const FMissionRuntimeState& State, TArray<uint8>& OutBytes)
+    {
+        OutBytes.Reset();
+        FMemoryWriter Writer(OutBytes, true);
+        FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+        FMissionRuntimeState::StaticStruct()->SerializeItem(Ar, const_cast<FMissionRuntimeState*>(&State), nullptr);
+    }
+
+    bool ReadMissionState(const TArray<uint8>& Bytes, FMissionRuntimeState& OutState)
+    {
+        FMemoryReader Reader(Bytes, true);
+        FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+        FMissionRuntimeState::StaticStruct()->SerializeItem(Ar, &OutState, nullptr);
+        return !Ar.IsError();
+    }
+
+    // Completed missions have no objective storage left, so an entry is just:
+    // MissionID, state, objective counts, completed objective IDs
+    void AppendCompletedMission(FGameplayTag MissionID, const FMissionRuntimeState& State, TArray<uint8>& Archive)
+    {
+        FMemoryWriter Writer(Archive, true, true);
+        FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+        FName MissionName = MissionID.GetTagName();
+        uint8 MissionState = (uint8)State.MissionState;
+        int32 Total = State.TotalObjectives;
+        int32 Remaining = State.RemainingObjectives;
+        int32 NumDone = State.CompletedObjectiveIDs.Num();
+        Ar << MissionName << MissionState << Total << Remaining << NumDone;
+
+        for (const FGameplayTag& ObjectiveID : State.CompletedObjectiveIDs)
+        {
+            FName ObjectiveName = ObjectiveID.GetTagName();
+            Ar << ObjectiveName;
+        }
+    }
+
+    bool ReadCompletedArchive(const TArray<uint8>& Archive, TMap<FGameplayTag, FMissionRuntimeState>& OutMissions)
+    {
+        if (Archive.Num() == 0) return true;
+
+        FMemoryReader Reader(Archive, true);
+        FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+
+        uint8 Version = 0;
+        Ar << Version;
+        if (Version != CompletedArchiveVersion) return false;
+
+        while (!Ar.AtEnd() && !Ar.IsError())
+        {
+            FName MissionName;
+            uint8 MissionState = 0;
+            int32 Total = 0, Remaining = 0, NumDone = 0;
+            Ar << MissionName << MissionState << Total << Remaining << NumDone;
+            if (Ar.IsError() || NumDone < 0 || NumDone > Ar.TotalSize() - Ar.Tell()) return false;
+
+            FMissionRuntimeState State;
+            State.MissionID = FGameplayTag::RequestGameplayTag(MissionName, false);
+            State.MissionState = (EProgressState)MissionState;
+            State.TotalObjectives = Total;
+            State.RemainingObjectives = Remaining;
+            State.CompletedObjectiveIDs.Reserve(NumDone);
+            for (int32 i = 0; i < NumDone; i++)
+            {
+                FName ObjectiveName;
+                Ar << ObjectiveName;
+                const FGameplayTag ObjectiveID = FGameplayTag::RequestGameplayTag(ObjectiveName, false);
+                if (ObjectiveID.IsValid()) State.CompletedObjectiveIDs.Add(ObjectiveID);
+            }
+
+            // Tags removed since the save are dropped. A mission finished twice keeps its last entry.
+            if (State.MissionID.IsValid())
+            {
+                OutMissions.Add(State.MissionID, MoveTemp(State));
+            }
+        }
+        return !Ar.IsError();
+    }
+
+#if COUNTERSTRACE_ENABLED
+    // Game thread only. Publishes the delivered-event rate about once a second.
+    void CountDeliveredEvent()
+    {
+        static double WindowStart = 0.0;
+        static int32 EventsInWindow = 0;
+
+        TRACE_COUNTER_INCREMENT(MissionEventsDelivered);
+        EventsInWindow++;
+
+        const double Now = FPlatformTime::Seconds();
+        if (Now - WindowStart >= 1.0)
+        {
+            TRACE_COUNTER_SET(MissionEventsPerSecond, EventsInWindow / (Now - WindowStart));
+            WindowStart = Now;
+            EventsInWindow = 0;
+        }
+    }
+#endif
+
+    // Approximate: the asset and its instanced objectives/actions. Assets they reference are not counted.
+    int64 EstimateMissionAssetSize(UMissionData* MissionAsset)
+    {
+        int64 Bytes = 0;
+        auto CountObject = [&Bytes](UObject* Object)
+        {
+            FArchiveCountMem CountMem(Object);
+            Bytes += CountMem.GetMax() + Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+        };
+
+        CountObject(MissionAsset);
+        ForEachObjectWithOuter(MissionAsset, CountObject, true);
+        return Bytes;
+    }
+
+    UMissionSubsystem* GetMissionSubsystem(UWorld* World)
+    {
+        UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+        return GI ? GI->GetSubsystem<UMissionSubsystem>() : nullptr;
+    }
+
+    void LogMissionResidency(UWorld* World)
+    {
+        if (const UMissionSubsystem* MissionSys = GetMissionSubsystem(World))
+        {
+            MissionSys->LogResidency();
+        }
+    }
+
+    FAutoConsoleCommandWithWorld MissionRecordStartCommand(
+        TEXT("Periphery.Mission.Record.Start"),
+        TEXT("Starts recording mission calls and events for headless replay."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+            if (UMissionSubsystem* MissionSys = GetMissionSubsystem(World)) MissionSys->StartRecording();
+        }));
+
+    FAutoConsoleCommandWithWorldAndArgs MissionRecordStopCommand(
+        TEXT("Periphery.Mission.Record.Stop"),
+        TEXT("Stops recording. Optional arg: output file (default Saved/MissionRecordings/<timestamp>.pmrec)."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UMissionSubsystem* MissionSys = GetMissionSubsystem(World);
+            if (!MissionSys) return;
+
+            const FString FilePath = Args.Num() > 0 ? Args[0]
+                : FPaths::ProjectSavedDir() / TEXT("MissionRecordings") / (FDateTime::Now().ToString() + TEXT(".pmrec"));
+            MissionSys->StopRecording(FilePath);
+        }));
+
+    FAutoConsoleCommandWithWorld MissionResidencyCommand(
+        TEXT("Periphery.Mission.Residency"),
+        TEXT("Lists resident mission assets with their estimated size and pin state."),
+        FConsoleCommandWithWorldDelegate::CreateStatic(&LogMissionResidency));
+
+    FAutoConsoleCommandWithWorld MissionActionStatsCommand(
+        TEXT("Periphery.Mission.ActionStats"),
+        TEXT("Lists mission action cost per action class and the number of pending action lists."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+            if (const UMissionSubsystem* MissionSys = GetMissionSubsystem(World))
+            {
+                MissionSys->LogActionStats();
+            }
+        }));
+}
 
 
 // ---------- Initialize ----------
@@ -12,11 +202,48 @@
 void UMissionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
-	UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: Initialized"));
+	UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Initialized"));
 
 	FString NetMode = (GetWorld()->GetNetMode() == NM_Client) ? "Client" : "Server";
-	UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: Init [%s]"), *NetMode);
+	UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Init [%s]"), *NetMode);
+
+}
+
+void UMissionSubsystem::Deinitialize()
+{
+    CancelRestore();
+    ReleaseAllPrefetches();
+    ActionExecutor.Reset();
+    ActionQueryCache.Reset();
+    DefaultContextFrame = MAX_uint64;
+
+    IncomingEvents.Empty();
+    PendingEvents.Empty();
+    PendingEventLookup.Empty();
+    PendingEventHead = 0;
+
+    Super::Deinitialize();
+}
 
+// ---------- Tick ----------
+
+bool UMissionSubsystem::IsTickable() const
+{
+    return !IsTemplate() && (!IncomingEvents.IsEmpty() || PendingEventHead < PendingEvents.Num() || TimerWheel.Num() > 0 || ActionExecutor.HasWork());
+}
+
+void UMissionSubsystem::Tick(float DeltaTime)
+{
+    const UPeripheryMissionSettings* Settings = GetDefault<UPeripheryMissionSettings>();
+    DrainQueuedEvents(Settings->EventBudgetMs / 1000.0);
+
+    // Events still flow while paused, time and actions don't
+    const UWorld* World = GetWorld();
+    if (!bRestoringMissions && (!World || !World->IsPaused()))
+    {
+        AdvanceTimers(DeltaTime);
+        ActionExecutor.Tick(MakeExecutionContext(nullptr), Settings->ActionBudgetMs / 1000.0);
+    }
 }
 
 
@@ -24,14 +251,17 @@ void UMissionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UMissionSubsystem::StartMission(FGameplayTag MissionID)
 {
+	RecordCall(EMissionRecordKind::StartMission, MissionID);
+	TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+
 	if (!MissionID.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MissionSubsystem: StartMission: Invalid MissionID"));
+		UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: StartMission: Invalid MissionID"));
 		return;
 	}
 	if (ActiveMissions.Contains(MissionID))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MissionSubsystem: StartMission: Mission already active: %s"), *MissionID.ToString());
+		UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: StartMission: Mission already active: %s"), *MissionID.ToString());
 		return;
 	}
 
@@ -40,38 +270,57 @@ void UMissionSubsystem::StartMission(FGameplayTag MissionID)
 	UAssetManager& Manager = UAssetManager::Get();
 
 	//Check if already loaded
-	if (UMissionData* Mission = Cast<UMissionData>(Manager.GetPrimaryAssetObject(AssetId)))
+	if (LoadedMissionAssets.Contains(MissionID) || Manager.GetPrimaryAssetObject(AssetId))
 	{
 		OnMissionAssetLoaded(AssetId, MissionID); // start if loaded
 	} 
 	else 
 	{
 		//Request Async Load.
-        UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: StartMission: Async loading asset for %s..."), *MissionID.ToString());
+        UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: StartMission: Async loading asset for %s..."), *MissionID.ToString());
 
         // Create the delegate
         FStreamableDelegate Delegate = FStreamableDelegate::CreateUObject
 			(this, &UMissionSubsystem::OnMissionAssetLoaded,  AssetId, MissionID);
 
         // Ask Asset Manager to load it in the background
-        Manager.LoadPrimaryAssets({ AssetId }, TArray<FName>(), Delegate);
+        Manager.LoadPrimaryAssets({ AssetId }, GetDefault<UPeripheryMissionSettings>()->MissionLoadBundles, Delegate);
 	}
 }
 
 void UMissionSubsystem::FinishMission(FGameplayTag MissionID, bool bSuccess)
 {
+	RecordCall(EMissionRecordKind::FinishMission, MissionID, FGameplayTag(), bSuccess);
+	TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+
 	FMissionRuntimeState* MissionRt = GetActiveMissionRuntime(MissionID);
 	if (!MissionRt) return;
 
 	MissionRt->MissionState = bSuccess ? EProgressState::Completed : EProgressState::Failed;
 
-	// Move to completed archive
-	CompletedMissions.Add(MissionID, *MissionRt);
+	// Any objectives still running stop hearing events and lose their timers
+	UnregisterMissionListeners(MissionID);
+	for (TPair<FGameplayTag, FObjectiveRuntimeState>& Pair : MissionRt->ActiveObjectives)
+	{
+		TimerWheel.Cancel(Pair.Value.DeadlineTimer);
+	}
+
+	// Move to completed archive. Objective storage is no longer needed there.
+	FMissionRuntimeState& Archived = CompletedMissions.Add(MissionID, MoveTemp(*MissionRt));
+	Archived.ActiveObjectives.Empty();
 	ActiveMissions.Remove(MissionID);
+	MarkMissionDirty(MissionID);
+	CompletedSinceSave.Add(MissionID);
 	OnMissionCompleted.Broadcast(MissionID, bSuccess);
 
 	const UMissionData* MissionAsset = GetMissionAsset(MissionID);
 
+	// The next mission won't be started from here, drop its prefetch
+	if (!bSuccess && MissionAsset)
+	{
+		ReleasePrefetch(MissionAsset->NextMissionID);
+	}
+
 	//Handle Next Mission
     if (bSuccess && MissionAsset && MissionAsset->NextMissionID.IsValid())
     {
@@ -79,6 +328,8 @@ void UMissionSubsystem::FinishMission(FGameplayTag MissionID, bool bSuccess)
         StartMission(MissionAsset->NextMissionID);
     }
 
+    // This mission's asset is no longer pinned
+    EnforceResidencyBudget();
 }
 
 bool UMissionSubsystem::IsMissionActive(FGameplayTag MissionID) const
@@ -87,22 +338,51 @@ bool UMissionSubsystem::IsMissionActive(FGameplayTag MissionID) const
 	return Rt && Rt->MissionState == EProgressState::InProgress;
 }
 
+float UMissionSubsystem::GetMissionProgress(FGameplayTag MissionID) const
+{
+	if (const FMissionRuntimeState* Rt = GetActiveMissionRuntime(MissionID))
+	{
+		return Rt->GetProgress();
+	}
+	return CompletedMissions.Contains(MissionID) ? 1.f : 0.f;
+}
+
+void UMissionSubsystem::InitializeCompletionCounter(FMissionRuntimeState& MissionRt, const UMissionData& MissionAsset)
+{
+	MissionRt.TotalObjectives = MissionAsset.GetNumObjectives();
+	MissionRt.RemainingObjectives = MissionRt.TotalObjectives;
+
+	for (const FGameplayTag& DoneID : MissionRt.CompletedObjectiveIDs)
+	{
+		if (MissionAsset.FindObjectiveIndex(DoneID) != INDEX_NONE)
+		{
+			MissionRt.RemainingObjectives--;
+		}
+	}
+}
+
 void UMissionSubsystem::ActivateObjective(FGameplayTag MissionID, FGameplayTag ObjectiveID)
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UMissionSubsystem::ActivateObjective);
+    RecordCall(EMissionRecordKind::ActivateObjective, MissionID, ObjectiveID);
+    TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+
     // LOG: Entry
-    UE_LOG(LogTemp, Log, TEXT("[Mission] Request Activate: %s (Mission: %s)"), *ObjectiveID.ToString(), *MissionID.ToString());
+    UE_LOG(LogPeripheryMission, Verbose, TEXT("[Mission] Request Activate: %s (Mission: %s)"), *ObjectiveID.ToString(), *MissionID.ToString());
 
     // Check if valid section
     if (!IsMissionActive(MissionID)) 
     {
-        UE_LOG(LogTemp, Warning, TEXT("[Mission] Failed to activate %s: Mission %s is not active."), *ObjectiveID.ToString(), *MissionID.ToString());
+        UE_LOG(LogPeripheryMission, Warning, TEXT("[Mission] Failed to activate %s: Mission %s is not active."), *ObjectiveID.ToString(), *MissionID.ToString());
         return;
     }
 
-    const UMissionObjective* ObjDef = GetObjectiveFromAsset(MissionID, ObjectiveID);
+    const UMissionData* MissionAsset = GetMissionAsset(MissionID);
+    const int32 ObjIndex = MissionAsset ? MissionAsset->FindObjectiveIndex(ObjectiveID) : INDEX_NONE;
+    const UMissionObjective* ObjDef = MissionAsset ? MissionAsset->GetObjectiveAt(ObjIndex) : nullptr;
     if (!ObjDef) 
     {
-        UE_LOG(LogTemp, Error, TEXT("[Mission] Failed to activate %s: Objective Definition not found in Asset."), *ObjectiveID.ToString());
+        UE_LOG(LogPeripheryMission, Error, TEXT("[Mission] Failed to activate %s: Objective Definition not found in Asset."), *ObjectiveID.ToString());
         return;
     }
 
@@ -111,20 +391,32 @@ void UMissionSubsystem::ActivateObjective(FGameplayTag MissionID, FGameplayTag O
     check(MissionRt); // This ensures we crash hard if logic is broken (since we checked IsMissionActive above)
 
     // LOG: State Change
-    UE_LOG(LogTemp, Display, TEXT("[Mission] ACTIVATED: %s added to ActiveObjectives."), *ObjectiveID.ToString());
+    UE_LOG(LogPeripheryMission, Verbose, TEXT("[Mission] ACTIVATED: %s added to ActiveObjectives."), *ObjectiveID.ToString());
 
     FObjectiveRuntimeState& ObjRt = MissionRt->ActiveObjectives.FindOrAdd(ObjectiveID);
     ObjRt.ObjectiveID = ObjectiveID;
+    MarkMissionDirty(MissionID);
     
     // 1. Delegate Initialization to the Object
     ObjDef->InitializeRuntime(ObjRt);
+    RegisterObjectiveListener(MissionID, *MissionAsset, ObjIndex);
+
+    TimerWheel.Cancel(ObjRt.DeadlineTimer);
+    if (ObjDef->GetTimeLimit() > 0.f)
+    {
+        FMissionTimerPayload Payload;
+        Payload.Kind = EMissionTimerKind::ObjectiveDeadline;
+        Payload.MissionID = MissionID;
+        Payload.ObjectiveID = ObjectiveID;
+        ObjRt.DeadlineTimer = TimerWheel.Schedule(ObjDef->GetTimeLimit(), Payload);
+    }
 
     // 2. Run Start Actions
-    AActor* Context = GetGameInstance()->GetFirstLocalPlayerController()->GetPawn();
-    
+    AActor* Context = GetDefaultContextActor();
+
     if (ObjDef->StartActions.Num() > 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("[Mission] Running %d Start Actions for %s..."), ObjDef->StartActions.Num(), *ObjectiveID.ToString());
+        UE_LOG(LogPeripheryMission, Verbose, TEXT("[Mission] Running %d Start Actions for %s..."), ObjDef->StartActions.Num(), *ObjectiveID.ToString());
     }
 
     RunActions(ObjDef->StartActions, Context);
@@ -133,9 +425,56 @@ void UMissionSubsystem::ActivateObjective(FGameplayTag MissionID, FGameplayTag O
 }
 
 void UMissionSubsystem::CompleteObjective(FGameplayTag MissionID, FGameplayTag ObjectiveID, bool bSuccess)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UMissionSubsystem::CompleteObjective);
+    RecordCall(EMissionRecordKind::CompleteObjective, MissionID, ObjectiveID, bSuccess);
+    TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+
+    // An explicit stack instead of recursion, so long dependency chains can't blow the native stack.
+    // Order is the same as recursing: a gatekeeper unlocked by X is completed entirely (its own dependents,
+    // actions and next objectives) before X's remaining dependents are notified and before X's actions run.
+    TArray<FCompletionFrame, TInlineAllocator<8>> Stack;
+    Stack.Add({ ObjectiveID, bSuccess });
+    TRACE_COUNTER_SET(MissionCompletionChainDepth, Stack.Num());
+
+    while (Stack.Num() > 0)
+    {
+        if (!ActiveMissions.Contains(MissionID)) break;
+
+        FCompletionFrame& Frame = Stack.Last();
+        if (!Frame.bStarted)
+        {
+            Frame.bStarted = true;
+            if (!BeginObjectiveCompletion(MissionID, Frame.ObjectiveID, Frame.bSuccess))
+            {
+                Stack.Pop();
+                TRACE_COUNTER_SET(MissionCompletionChainDepth, Stack.Num());
+                continue;
+            }
+        }
+
+        // Chain reactions always succeed
+        FGameplayTag Unlocked;
+        if (Frame.bSuccess && NotifyNextDependent(MissionID, Frame, Unlocked))
+        {
+            Stack.Add({ Unlocked, true });
+            TRACE_COUNTER_SET(MissionCompletionChainDepth, Stack.Num());
+            continue;
+        }
+
+        const FCompletionFrame Done = Stack.Pop();
+        TRACE_COUNTER_SET(MissionCompletionChainDepth, Stack.Num());
+        FinishObjectiveCompletion(MissionID, Done.ObjectiveID, Done.bSuccess);
+    }
+
+    // Also when the mission ended mid-chain
+    TRACE_COUNTER_SET(MissionCompletionChainDepth, 0);
+}
+
+bool UMissionSubsystem::BeginObjectiveCompletion(FGameplayTag MissionID, FGameplayTag ObjectiveID, bool bSuccess)
 {
     // LOG: Entry Point (Helpful to see the start of the frame)
-    UE_LOG(LogTemp, Log, TEXT("MissionSubsystem:  Request Complete: %s (Mission: %s) Success: %d"), 
+    UE_LOG(LogPeripheryMission, Verbose, TEXT("MissionSubsystem:  Request Complete: %s (Mission: %s) Success: %d"), 
         *ObjectiveID.ToString(), *MissionID.ToString(), bSuccess);
 
     // --- 1. OPTIMIZATION: Direct Map Lookups ---
@@ -144,16 +483,16 @@ void UMissionSubsystem::CompleteObjective(FGameplayTag MissionID, FGameplayTag O
     FMissionRuntimeState* MissionRt = ActiveMissions.Find(MissionID);
     if (!MissionRt) 
     {
-        UE_LOG(LogTemp, Warning, TEXT("MissionSubsystem:  Failed: Mission %s is not active."), *MissionID.ToString());
-        return;
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem:  Failed: Mission %s is not active."), *MissionID.ToString());
+        return false;
     }
 
     // Lookup Asset ONCE
     const UMissionData* MissionAsset = GetMissionAsset(MissionID);
     if (!MissionAsset) 
     {
-        UE_LOG(LogTemp, Error, TEXT("MissionSubsystem:  Failed: DataAsset for %s missing."), *MissionID.ToString());
-        return;
+        UE_LOG(LogPeripheryMission, Error, TEXT("MissionSubsystem:  Failed: DataAsset for %s missing."), *MissionID.ToString());
+        return false;
     }
 
     // Lookup Objective State ONCE
@@ -162,94 +501,111 @@ void UMissionSubsystem::CompleteObjective(FGameplayTag MissionID, FGameplayTag O
     // Validate State
     if (!ObjRt)
     {
-        UE_LOG(LogTemp, Warning, TEXT("MissionSubsystem:  Failed: Objective %s is not in ActiveObjectives list."), *ObjectiveID.ToString());
-        return;
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem:  Failed: Objective %s is not in ActiveObjectives list."), *ObjectiveID.ToString());
+        return false;
     }
     if (ObjRt->ObjectiveState != EProgressState::InProgress)
     {
-        UE_LOG(LogTemp, Warning, TEXT("MissionSubsystem:  Failed: Objective %s is already %s."), 
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem:  Failed: Objective %s is already %s."), 
             *ObjectiveID.ToString(), 
             (ObjRt->ObjectiveState == EProgressState::Completed ? TEXT("Completed") : TEXT("Failed")));
-        return;
+        return false;
     }
 
-    // Find Definition locally
-    const UMissionObjective* ObjDef = nullptr;
-    for (const auto& Obj : MissionAsset->ObjectiveArray)
-    {
-        if (Obj && Obj->ObjectiveID == ObjectiveID)
-        {
-            ObjDef = Obj;
-            break;
-        }
-    }
+    // Find Definition through the asset's compiled graph
+    const int32 ObjIndex = MissionAsset->FindObjectiveIndex(ObjectiveID);
+    const UMissionObjective* ObjDef = MissionAsset->GetObjectiveAt(ObjIndex);
     if (!ObjDef) 
     {
-        UE_LOG(LogTemp, Error, TEXT("MissionSubsystem:  Failed: Objective Definition %s not found in Asset."), *ObjectiveID.ToString());
-        return;
+        UE_LOG(LogPeripheryMission, Error, TEXT("MissionSubsystem:  Failed: Objective Definition %s not found in Asset."), *ObjectiveID.ToString());
+        return false;
     }
 
     // --- 2. Update State ---
 
     // Mark Complete
     ObjRt->ObjectiveState = bSuccess ? EProgressState::Completed : EProgressState::Failed;
+    MarkMissionDirty(MissionID);
+    TimerWheel.Cancel(ObjRt->DeadlineTimer);
     
     // Update Mission History
-    MissionRt->CompletedObjectiveIDs.Add(ObjectiveID);
+    bool bAlreadyDone = false;
+    MissionRt->CompletedObjectiveIDs.Add(ObjectiveID, &bAlreadyDone);
+    if (!bAlreadyDone)
+    {
+        MissionRt->RemainingObjectives--;
+    }
     MissionRt->ActiveObjectives.Remove(ObjectiveID);
+    UnregisterObjectiveListener(MissionID, *MissionAsset, ObjIndex);
+
+    if (bSuccess)
+    {
+        PrefetchNextMission(*MissionRt, *MissionAsset);
+    }
 
-    // LOG: Vital State Change (Using Display so it's White/Visible in logs)
-    UE_LOG(LogTemp, Display, TEXT("MissionSubsystem:  SUCCESS: %s set to %s."), 
+    // LOG: Vital State Change (Verbose: runs once per objective, often inside chains)
+    UE_LOG(LogPeripheryMission, Verbose, TEXT("MissionSubsystem:  SUCCESS: %s set to %s."), 
         *ObjectiveID.ToString(), (bSuccess ? TEXT("Completed") : TEXT("Failed")));
 
     // Broadcast
     OnObjectiveCompleted.Broadcast(MissionID, ObjectiveID, bSuccess);
 
-    // --- 3. THE OnComplete LOOP ---
-    if (bSuccess)
+    return true;
+}
+
+bool UMissionSubsystem::NotifyNextDependent(FGameplayTag MissionID, FCompletionFrame& Frame, FGameplayTag& OutUnlocked)
+{
+    // --- 3. Notify Dependents (Gatekeepers waiting on this objective) ---
+    FMissionRuntimeState* MissionRt = ActiveMissions.Find(MissionID);
+    const UMissionData* MissionAsset = GetMissionAsset(MissionID);
+    if (!MissionRt || !MissionAsset) return false;
+
+    const TArrayView<const int32> Dependents = MissionAsset->GetRuntimeGraph().GetDependentNodes(MissionAsset->FindObjectiveIndex(Frame.ObjectiveID));
+    while (Frame.NextDependent < Dependents.Num())
     {
-        TArray<FGameplayTag> ActiveIDs;
-        MissionRt->ActiveObjectives.GetKeys(ActiveIDs);
+        const UMissionObjective* DependentDef = MissionAsset->GetObjectiveAt(Dependents[Frame.NextDependent++]);
+        if (!DependentDef) continue;
 
-        for (const FGameplayTag& SearchID : ActiveIDs)
-        {
-            if (SearchID == ObjectiveID) continue; 
+        FObjectiveRuntimeState* DependentRt = MissionRt->ActiveObjectives.Find(DependentDef->ObjectiveID);
+        if (!DependentRt || DependentRt->ObjectiveState != EProgressState::InProgress) continue;
 
-            FObjectiveRuntimeState* OtherObjRt = MissionRt->ActiveObjectives.Find(SearchID);
-            const UMissionObjective* OtherObjDef = GetObjectiveFromAsset(MissionID, SearchID);
+        // "Hey Gatekeeper, ObjectiveID just finished." Did that finish the Gatekeeper?
+        if (DependentDef->OnObjectiveCompleted(Frame.ObjectiveID, *DependentRt) && DependentDef->IsComplete(*DependentRt))
+        {
+            // LOG: Critical - Identifying Chain Reactions
+            UE_LOG(LogPeripheryMission, Verbose, TEXT("MissionSubsystem:  CHAIN REACTION: %s triggered completion of %s."), 
+                *Frame.ObjectiveID.ToString(), *DependentDef->ObjectiveID.ToString());
 
-            if (OtherObjRt && OtherObjDef)
-            {
-                // "Hey Gatekeeper, ObjectiveID just finished."
-                if (OtherObjDef->OnObjectiveCompleted(ObjectiveID, *OtherObjRt))
-                {
-                    // Did that finish the Gatekeeper?
-                    if (OtherObjDef->IsComplete(*OtherObjRt))
-                    {
-                        // LOG: Critical - Identifying Chain Reactions
-                        UE_LOG(LogTemp, Display, TEXT("MissionSubsystem:  CHAIN REACTION: %s triggered completion of %s."), 
-                            *ObjectiveID.ToString(), *SearchID.ToString());
-
-                        // RECURSION: Finish the Gatekeeper immediately
-                        CompleteObjective(MissionID, SearchID, true);
-                        
-                        if (!ActiveMissions.Contains(MissionID)) return;
-                    }
-                }
-            }
+            OutUnlocked = DependentDef->ObjectiveID;
+            return true;
         }
     }
+    return false;
+}
+
+void UMissionSubsystem::FinishObjectiveCompletion(FGameplayTag MissionID, FGameplayTag ObjectiveID, bool bSuccess)
+{
+    FMissionRuntimeState* MissionRt = ActiveMissions.Find(MissionID);
+    const UMissionData* MissionAsset = GetMissionAsset(MissionID);
+    if (!MissionRt || !MissionAsset) return;
 
     // --- 4. Handle Flow (Actions & Next Objectives) ---
     
     if (bSuccess)
     {
+        const int32 ObjIndex = MissionAsset->FindObjectiveIndex(ObjectiveID);
+        const UMissionObjective* ObjDef = MissionAsset->GetObjectiveAt(ObjIndex);
+        if (!ObjDef) return;
+
         // LOG: Flow confirmation
-        UE_LOG(LogTemp, Log, TEXT("MissionSubsystem:  Processing Actions/Next Objectives for %s..."), *ObjectiveID.ToString());
+        UE_LOG(LogPeripheryMission, Verbose, TEXT("MissionSubsystem:  Processing Actions/Next Objectives for %s..."), *ObjectiveID.ToString());
+
+        RunActions(ObjDef->CompleteActions, GetDefaultContextActor());
+        ActivateNextObjectives(MissionID, *MissionAsset, MissionAsset->GetRuntimeGraph().GetNextNodes(ObjIndex));
 
-        AActor* Context = GetGameInstance()->GetFirstLocalPlayerController()->GetPawn();
-        RunActions(ObjDef->CompleteActions, Context);
-        ActivateNextObjectives(MissionID, ObjDef->NextObjectiveIDs);
+        // Actions may have started or finished missions, which invalidates the pointer
+        MissionRt = ActiveMissions.Find(MissionID);
+        if (!MissionRt) return;
     }
 
     // --- 5. Check Mission Completion ---
@@ -259,29 +615,20 @@ void UMissionSubsystem::CompleteObjective(FGameplayTag MissionID, FGameplayTag O
         return; 
     }
 
-    bool bAllCompleted = true;
-    for (const auto& Obj : MissionAsset->ObjectiveArray)
-    {
-        if (Obj && !MissionRt->CompletedObjectiveIDs.Contains(Obj->ObjectiveID))
-        {
-            bAllCompleted = false;
-            break;
-        }
-    }
-
-    if (bAllCompleted)
+    if (MissionRt->RemainingObjectives <= 0)
     {
         // LOG: Vital - Mission Finish
-        UE_LOG(LogTemp, Display, TEXT("MissionSubsystem:  MISSION COMPLETE: %s has no remaining objectives."), *MissionID.ToString());
+        UE_LOG(LogPeripheryMission, Display, TEXT("MissionSubsystem:  MISSION COMPLETE: %s has no remaining objectives."), *MissionID.ToString());
         FinishMission(MissionID, true);
     }
 }
 
-void UMissionSubsystem::ActivateNextObjectives(FGameplayTag MissionID, const TArray<FGameplayTag>& NextObjectiveIDs)
+void UMissionSubsystem::ActivateNextObjectives(FGameplayTag MissionID, const UMissionData& MissionAsset, TArrayView<const int32> NextObjectiveIndices)
 {
-    for (const FGameplayTag& NextObj : NextObjectiveIDs)
+    // Edges were resolved when the graph was compiled, dangling IDs never get here
+    for (const int32 NextIndex : NextObjectiveIndices)
     {
-        ActivateObjective(MissionID, NextObj);
+        ActivateObjective(MissionID, MissionAsset.GetRuntimeGraph().GetNode(NextIndex)->ObjectiveID);
     }
 }
 
@@ -297,19 +644,10 @@ const UMissionObjective* UMissionSubsystem::GetObjectiveFromAsset(FGameplayTag M
     const UMissionData* Mission = GetMissionAsset(MissionID);
     if (!Mission) return nullptr;
 
-   const UMissionObjective* ObjDef = nullptr;
-    for (const UMissionObjective* Obj : Mission->ObjectiveArray)
-    {
-        if (Obj && Obj->ObjectiveID == ObjectiveID)
-        {
-            ObjDef = Obj;
-            break;
-        }
-    }
-
+    const UMissionObjective* ObjDef = Mission->FindObjective(ObjectiveID);
     if (!ObjDef)
     {
-        UE_LOG(LogTemp, Warning, TEXT("MissionSubsystem:  ActivateObjective: Obj not found: %s"), *ObjectiveID.ToString());
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem:  ActivateObjective: Obj not found: %s"), *ObjectiveID.ToString());
         return nullptr;
     }
     return ObjDef;
@@ -323,6 +661,10 @@ const UMissionData* UMissionSubsystem::GetMissionAsset(FGameplayTag MissionID) c
     // 1. Check cache 
     if (const UMissionData* const* Found = LoadedMissionAssets.Find(MissionID))
     {
+        if (FMissionResidency* Residency = ResidentMissionAssets.Find(MissionID))
+        {
+            Residency->LastUsedTime = FPlatformTime::Seconds();
+        }
         return *Found;
     }
 
@@ -338,201 +680,1180 @@ const UMissionData* UMissionSubsystem::GetMissionAsset(FGameplayTag MissionID) c
 
 void UMissionSubsystem::OnMissionAssetLoaded(FPrimaryAssetId LoadedId, FGameplayTag MissionID)
 {
-	
+    // Part of the StartMission that requested the load
+    TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+
     UAssetManager& Manager = UAssetManager::Get();
     UMissionData* MissionAsset = Cast<UMissionData>(Manager.GetPrimaryAssetObject(LoadedId));
+    if (!MissionAsset)
+    {
+        // Registered directly (RegisterMissionAsset)
+        MissionAsset = LoadedMissionAssets.FindRef(MissionID);
+    }
 
     if (!MissionAsset)
     {
-        UE_LOG(LogTemp, Error, TEXT("MissionSubsystem: StartMission: Failed to load asset for %s"), *MissionID.ToString());
+        UE_LOG(LogPeripheryMission, Error, TEXT("MissionSubsystem: StartMission: Failed to load asset for %s"), *MissionID.ToString());
         return;
     }
 
     // Cache it explicitly so it doesn't get garbage collected while active
-    LoadedMissionAssets.Add(MissionID, MissionAsset);
-    UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: StartMission: Asset loaded. Starting logic for %s"), *MissionID.ToString());
+    TrackResidentAsset(MissionID, MissionAsset);
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: StartMission: Asset loaded. Starting logic for %s"), *MissionID.ToString());
+
+    // Hand-off: LoadedMissionAssets keeps it now
+    HandOffPrefetch(MissionID);
 
 	//Initiate Runtime State
 	FMissionRuntimeState& MissionRt = ActiveMissions.FindOrAdd(MissionID);
 	MissionRt.MissionID = MissionID;
 	MissionRt.MissionState = EProgressState::InProgress;
+	InitializeCompletionCounter(MissionRt, *MissionAsset);
+	MarkMissionDirty(MissionID);
 	OnMissionStarted.Broadcast(MissionID);
 
-	UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: StartMission: Mission started: %s"), *MissionID.ToString());
+	UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: StartMission: Mission started: %s"), *MissionID.ToString());
 
-	for (const UMissionObjective* Obj : MissionAsset->ObjectiveArray)
+	for (const int32 ObjIndex : MissionAsset->GetRuntimeGraph().GetAutoStartNodes())
     {
-        if (Obj && Obj->bStartAutomatically) // Access property directly
-        {
-            ActivateObjective(MissionID, Obj->ObjectiveID); 
-        }
+        ActivateObjective(MissionID, MissionAsset->GetRuntimeGraph().GetNode(ObjIndex)->ObjectiveID); 
     }
 
 }
 
 void UMissionSubsystem::ResetSystem()
 {
+    CancelRestore();
+    ClearSaveCache();
+    ReleaseAllPrefetches();
+    TimerWheel.Reset();
+    ActionExecutor.Reset();
+    ActionQueryCache.Reset();
+    DefaultContextFrame = MAX_uint64;
     ActiveMissions.Empty();
     CompletedMissions.Empty();
+    EnforceResidencyBudget();
+    EventListeners.Empty();
+    SourceIdCache.Empty();
+
+    // Drop events that were aimed at the old state
+    IncomingEvents.Empty();
+    PendingEvents.Empty();
+    PendingEventLookup.Empty();
+    PendingEventHead = 0;
 }
 
-// ---------- Event Bus ----------
+// ---------- Timers ----------
 
-void UMissionSubsystem::EmitActorEvent(AActor* SourceActor, FGameplayTag EventTag)
+FMissionTimerHandle UMissionSubsystem::ScheduleDelayedAction(const UMissionAction* Action, AActor* ContextActor, float DelaySeconds)
 {
-    if (!EventTag.IsValid()) return;
+    if (!Action) return FMissionTimerHandle();
 
-    if (SourceActor)
-    {
-        // 1. Get the Wrapper Struct first
-        FActorSet& SetStruct = EventHistoryDB.FindOrAdd(EventTag);
+    FMissionTimerPayload Payload;
+    Payload.Kind = EMissionTimerKind::DelayedAction;
+    Payload.Action = Action;
+    Payload.ContextActor = ContextActor;
+    return TimerWheel.Schedule(DelaySeconds, Payload);
+}
 
-        // 2. Then get the Set from inside it
-        TSet<FName>& ActorSet = SetStruct.ActorNames;
-        
-        // 3. Add the new Actor to the set.
-        ActorSet.Add(SourceActor->GetFName());
-    }
+float UMissionSubsystem::GetObjectiveTimeRemaining(FGameplayTag MissionID, FGameplayTag ObjectiveID) const
+{
+    const FObjectiveRuntimeState* ObjRt = GetObjectiveRuntime(MissionID, ObjectiveID);
+    return ObjRt ? TimerWheel.GetRemainingSeconds(ObjRt->DeadlineTimer) : -1.f;
+}
+
+void UMissionSubsystem::AdvanceTimers(float DeltaSeconds)
+{
+    if (TimerWheel.Num() == 0) return;
+    TRACE_CPUPROFILER_EVENT_SCOPE(UMissionSubsystem::AdvanceTimers);
 
-    OnMissionEventBroadcast.Broadcast(EventTag);
+    ExpiredTimers.Reset();
+    TimerWheel.Advance(DeltaSeconds, ExpiredTimers);
 
-    // Broadcaster: Send to all active objectives
-    for (TPair<FGameplayTag, FMissionRuntimeState>& MissionPair : ActiveMissions)
+    // Handlers may schedule or cancel timers, so each one is claimed right before it runs
+    for (const FMissionTimerHandle& Handle : ExpiredTimers)
     {
-        const UMissionData* MissionAsset = GetMissionAsset(MissionPair.Key);
-        if (!MissionAsset) continue;
+        FMissionTimerPayload Payload;
+        if (!TimerWheel.Consume(Handle, Payload)) continue;
 
-        for (const auto& Obj : MissionAsset->ObjectiveArray)
+        if (Payload.Kind == EMissionTimerKind::DelayedAction)
         {
-            if (!Obj) continue;
-
-            FObjectiveRuntimeState* ObjRt = MissionPair.Value.ActiveObjectives.Find(Obj->ObjectiveID);
-            if (!ObjRt || ObjRt->ObjectiveState != EProgressState::InProgress) continue;
-
-            // Pass to Router
-            ConsumeEventForObjective(MissionPair.Key, Obj, *ObjRt, EventTag, SourceActor);
+            const UMissionAction* Action = Payload.Action.Get();
+            if (!Action) continue;
+
+            // The context may be gone (or wasn't saved), fall back to the player
+            AActor* Context = Payload.ContextActor.Get();
+            if (!Context) Context = GetDefaultContextActor();
+            ActionExecutor.Run(Action, MakeExecutionContext(Context), GetDefault<UPeripheryMissionSettings>()->ActionBudgetMs / 1000.0);
+            continue;
         }
-    }
-}
 
-void UMissionSubsystem::ConsumeEventForObjective(FGameplayTag MissionID, const UMissionObjective* ObjDef, FObjectiveRuntimeState& ObjRt, FGameplayTag EventTag, AActor* SourceActor)
-{
-    UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: Attempt to Consume Event For Objective"));
+        // Objective time limit
+        FObjectiveRuntimeState* ObjRt = GetObjectiveRuntime(Payload.MissionID, Payload.ObjectiveID);
+        const UMissionObjective* ObjDef = GetObjectiveFromAsset(Payload.MissionID, Payload.ObjectiveID);
+        if (!ObjRt || !ObjDef || ObjRt->ObjectiveState != EProgressState::InProgress) continue;
 
-    if (ObjDef->OnEvent(MissionID, EventTag, SourceActor, ObjRt))
-    {
-        UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: Consuming Event For Objective"));
-        // "Are you done?"
-        if (ObjDef->IsComplete(ObjRt))
+        ObjRt->DeadlineTimer.Invalidate();
+        UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Time limit reached for %s"), *Payload.ObjectiveID.ToString());
+
+        if (ObjDef->OnTimerExpired(Payload.MissionID, *ObjRt))
         {
-            CompleteObjective(MissionID, ObjDef->ObjectiveID, true);
+            MarkMissionDirty(Payload.MissionID);
+            ResolveObjectiveOutcome(Payload.MissionID, ObjDef, *ObjRt);
         }
     }
 }
 
-int32 UMissionSubsystem::GetEventCount(FGameplayTag EventTag)
+// ---------- Recording ----------
+
+void UMissionSubsystem::StartRecording()
 {
-    if (const FActorSet* SetStruct = EventHistoryDB.Find(EventTag))
-    {
-        return SetStruct->ActorNames.Num();
-    }
-    return 0;
+    Recorder = MakeUnique<FMissionEventRecorder>();
+    Recorder->Start();
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Recording started"));
 }
 
-bool UMissionSubsystem::HasActorDoneEvent(AActor* Actor, FGameplayTag EventTag) 
+bool UMissionSubsystem::StopRecording(const FString& FilePath)
 {
-   if (FActorSet* SetStruct = EventHistoryDB.Find(EventTag))
-   {
-        if (SetStruct->ActorNames.Find(Actor->GetFName())) return true;
-   }
-   return false;
-}
+    if (!Recorder) return false;
 
-// ---------- Runtime getters ----------
+    // Queued events belong to the recording
+    FlushQueuedEvents();
 
-FMissionRuntimeState* UMissionSubsystem::GetActiveMissionRuntime(FGameplayTag MissionID)
-{
-	return MissionID.IsValid() ? ActiveMissions.Find(MissionID) : nullptr;
+    TMap<FName, TArray<uint8>> FinalState;
+    FMissionEventRecorder::BuildStateSnapshot(ActiveMissions, CompletedMissions, FinalState);
+
+    const bool bSaved = Recorder->SaveToFile(FilePath, FinalState);
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Recording stopped, %d entries %s %s"),
+        Recorder->Num(), bSaved ? TEXT("written to") : TEXT("FAILED to write to"), *FilePath);
+
+    Recorder.Reset();
+    return bSaved;
 }
 
-const FMissionRuntimeState* UMissionSubsystem::GetActiveMissionRuntime(FGameplayTag MissionID) const
+void UMissionSubsystem::RecordCall(EMissionRecordKind Kind, FGameplayTag PrimaryTag, FGameplayTag ObjectiveID, bool bSuccess)
 {
-	return MissionID.IsValid() ? ActiveMissions.Find(MissionID) : nullptr;
+    if (!Recorder || RecordingDepth > 0) return;
+
+    FMissionRecordEntry Entry;
+    Entry.Kind = Kind;
+    Entry.PrimaryTag = PrimaryTag;
+    Entry.ObjectiveID = ObjectiveID;
+    Entry.bSuccess = bSuccess;
+    Recorder->Add(MoveTemp(Entry));
 }
 
-FObjectiveRuntimeState* UMissionSubsystem::GetObjectiveRuntime(FGameplayTag MissionID, FGameplayTag ObjectiveID)
+void UMissionSubsystem::RecordEvent(FGameplayTag EventTag, AActor* SourceActor, int32 Count)
 {
-	FMissionRuntimeState* MissionRt = GetActiveMissionRuntime(MissionID);
-	return (MissionRt && ObjectiveID.IsValid()) ? MissionRt->ActiveObjectives.Find(ObjectiveID) : nullptr;
+    // Events are recorded at any depth: actors react to actions, and replay proxies won't
+    if (!Recorder) return;
+
+    FMissionRecordEntry Entry;
+    Entry.Kind = EMissionRecordKind::Event;
+    Entry.PrimaryTag = EventTag;
+    Entry.SourceId = SourceActor ? GetSourceId(SourceActor) : FGuid();
+    Entry.Count = Count;
+    Recorder->Add(MoveTemp(Entry));
 }
 
-const FObjectiveRuntimeState* UMissionSubsystem::GetObjectiveRuntime(FGameplayTag MissionID, FGameplayTag ObjectiveID) const
+// ---------- Residency ----------
+
+void UMissionSubsystem::RegisterMissionAsset(UMissionData* MissionAsset)
 {
-	const FMissionRuntimeState* MissionRt = GetActiveMissionRuntime(MissionID);
-	return (MissionRt && ObjectiveID.IsValid()) ? MissionRt->ActiveObjectives.Find(ObjectiveID) : nullptr;
+    if (!MissionAsset || !MissionAsset->MissionID.IsValid()) return;
+
+    TrackResidentAsset(MissionAsset->MissionID, MissionAsset);
 }
 
+void UMissionSubsystem::TrackResidentAsset(FGameplayTag MissionID, UMissionData* MissionAsset)
+{
+    LoadedMissionAssets.Add(MissionID, MissionAsset);
 
-// ---------- Actions ----------
+    FMissionResidency& Residency = ResidentMissionAssets.FindOrAdd(MissionID);
+    if (Residency.SizeBytes == 0)
+    {
+        Residency.SizeBytes = EstimateMissionAssetSize(MissionAsset);
+    }
+    Residency.LastUsedTime = FPlatformTime::Seconds();
+}
 
-void UMissionSubsystem::RunActions(const TArray<TObjectPtr<UMissionAction>>& Actions, AActor* ContextActor)
+int64 UMissionSubsystem::GetResidentMissionAssetBytes() const
 {
-    for (const UMissionAction* Action : Actions)
+    int64 Total = 0;
+    for (const TPair<FGameplayTag, FMissionResidency>& Pair : ResidentMissionAssets)
     {
-        if (Action)
+        Total += Pair.Value.SizeBytes;
+    }
+    return Total;
+}
+
+void UMissionSubsystem::EnforceResidencyBudget()
+{
+    const int64 BudgetBytes = (int64)GetDefault<UPeripheryMissionSettings>()->MissionAssetBudgetKB * 1024;
+    int64 Total = GetResidentMissionAssetBytes();
+
+    while (Total > BudgetBytes)
+    {
+        // 1. Least recently used mission that isn't running
+        FGameplayTag Victim;
+        double OldestTime = TNumericLimits<double>::Max();
+        for (const TPair<FGameplayTag, FMissionResidency>& Pair : ResidentMissionAssets)
         {
-            // The Action contains its own logic.
-            Action->ExecuteAction(ContextActor);
+            if (ActiveMissions.Contains(Pair.Key)) continue;
+            if (Pair.Value.LastUsedTime < OldestTime)
+            {
+                OldestTime = Pair.Value.LastUsedTime;
+                Victim = Pair.Key;
+            }
         }
+        if (!Victim.IsValid()) break; // Everything left is pinned
+
+        // 2. Drop our reference and the Asset Manager's, GC reclaims it
+        Total -= ResidentMissionAssets.FindAndRemoveChecked(Victim).SizeBytes;
+        LoadedMissionAssets.Remove(Victim);
+        UAssetManager::Get().UnloadPrimaryAsset(FPrimaryAssetId(UMissionData::StaticClass()->GetFName(), Victim.GetTagName()));
+
+        UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Unloaded mission asset %s (resident %lld / %lld KiB)"),
+            *Victim.ToString(), Total / 1024, BudgetBytes / 1024);
     }
 }
 
-
-// ---------- Save System ----------
-void UMissionSubsystem::SaveToGame(UPeripherySaveGame* SaveObject)
+void UMissionSubsystem::LogResidency() const
 {
-    if (!SaveObject) return;
+    const double Now = FPlatformTime::Seconds();
+    for (const TPair<FGameplayTag, FMissionResidency>& Pair : ResidentMissionAssets)
+    {
+        UE_LOG(LogPeripheryMission, Display, TEXT("  %-40s %8lld KiB  %s  idle %.1fs"),
+            *Pair.Key.ToString(), Pair.Value.SizeBytes / 1024,
+            ActiveMissions.Contains(Pair.Key) ? TEXT("PINNED") : TEXT("      "),
+            Now - Pair.Value.LastUsedTime);
+    }
 
-    // Just copy the maps directly. 
-    // Unreal handles the struct serialization automatically.
-    SaveObject->ActiveMissions = ActiveMissions;
-    SaveObject->CompletedMissions = CompletedMissions;
-    SaveObject->EventHistoryDB = EventHistoryDB;
-    
-    UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: Data Saved to Object"));
+    UE_LOG(LogPeripheryMission, Display, TEXT("MissionSubsystem: %d mission assets resident, %lld / %d KiB, %d archived missions, %d prefetches"),
+        ResidentMissionAssets.Num(), GetResidentMissionAssetBytes() / 1024,
+        GetDefault<UPeripheryMissionSettings>()->MissionAssetBudgetKB, CompletedMissions.Num(), PrefetchHandles.Num());
 }
 
-void UMissionSubsystem::LoadFromGame(const UPeripherySaveGame* SaveObject)
+// ---------- Prefetch ----------
+
+void UMissionSubsystem::PrefetchNextMission(const FMissionRuntimeState& MissionRt, const UMissionData& MissionAsset)
 {
-    if (!SaveObject) return;
+    const FGameplayTag NextMissionID = MissionAsset.NextMissionID;
+    if (!NextMissionID.IsValid() || PrefetchHandles.Contains(NextMissionID) || ActiveMissions.Contains(NextMissionID)) return;
 
-    // 1. Clear current state
-    ActiveMissions.Empty();
-    CompletedMissions.Empty();
-    
-    // 2. Copy data back
-    ActiveMissions = SaveObject->ActiveMissions;
-    CompletedMissions = SaveObject->CompletedMissions;
-    EventHistoryDB = SaveObject->EventHistoryDB;
+    const UPeripheryMissionSettings* Settings = GetDefault<UPeripheryMissionSettings>();
+    const float Progress = MissionRt.GetProgress();
+    if (Progress < Settings->PrefetchProgressThreshold) return;
 
-    // 3. CRITICAL: Restore Asset Pointers
-    // The SaveFile knows the Tags ("Mission.ShiftStart") but it does NOT store the Asset Pointers.
-    // We must reload the assets so the game logic works.
-    
-    for (auto& Pair : ActiveMissions)
+    FPrimaryAssetId AssetId(UMissionData::StaticClass()->GetFName(), NextMissionID.GetTagName());
+    UAssetManager& Manager = UAssetManager::Get();
+
+    // Already resident with its bundles, nothing to load
+    if (Manager.GetPrimaryAssetObject(AssetId))
     {
-        FGameplayTag MissionID = Pair.Key;
-        
-        // This function (from our previous steps) forces the asset to load into memory
-        // so GetMissionAsset(ID) will work later.
-        const UMissionData* Asset = GetMissionAsset(MissionID); 
-        
-        if (Asset)
+        TArray<FName> LoadedBundles;
+        Manager.GetPrimaryAssetHandle(AssetId, false, &LoadedBundles);
+
+        bool bHasBundles = true;
+        for (const FName& Bundle : Settings->MissionLoadBundles)
         {
-            // Explicitly cache it to be safe
-            LoadedMissionAssets.Add(MissionID, const_cast<UMissionData*>(Asset));
+            bHasBundles &= LoadedBundles.Contains(Bundle);
         }
+        if (bHasBundles) return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("MissionSubsystem: Data Loaded from Object"));
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Prefetching %s (%s at %.0f%%)"),
+        *NextMissionID.ToString(), *MissionRt.MissionID.ToString(), Progress * 100.f);
+
+    FStreamableDelegate Delegate = FStreamableDelegate::CreateUObject
+        (this, &UMissionSubsystem::OnPrefetchLoaded, NextMissionID);
+
+    TSharedPtr<FStreamableHandle> Handle = Manager.LoadPrimaryAssets({ AssetId }, Settings->MissionLoadBundles, Delegate);
+    if (Handle.IsValid())
+    {
+        PrefetchHandles.Add(NextMissionID, Handle);
+    }
+}
+
+void UMissionSubsystem::OnPrefetchLoaded(FGameplayTag NextMissionID)
+{
+    FPrimaryAssetId AssetId(UMissionData::StaticClass()->GetFName(), NextMissionID.GetTagName());
+    if (!UAssetManager::Get().GetPrimaryAssetObject(AssetId))
+    {
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: Prefetch failed for %s"), *NextMissionID.ToString());
+        ReleasePrefetch(NextMissionID);
+        return;
+    }
+
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Prefetched %s"), *NextMissionID.ToString());
+}
+
+void UMissionSubsystem::ReleasePrefetch(FGameplayTag NextMissionID)
+{
+    if (PrefetchHandles.Remove(NextMissionID) == 0) return;
+
+    // The handle is the Asset Manager's own bundle state for the asset, so cancelling it would also drop
+    // loads other callers rely on. Undo the prefetch through the manager instead.
+    if (ActiveMissions.Contains(NextMissionID) || !UAssetManager::IsInitialized()) return;
+
+    FPrimaryAssetId AssetId(UMissionData::StaticClass()->GetFName(), NextMissionID.GetTagName());
+    UAssetManager& Manager = UAssetManager::Get();
+    if (LoadedMissionAssets.Contains(NextMissionID))
+    {
+        // Resident before the prefetch: keep the asset, drop the bundles we added
+        Manager.ChangeBundleStateForPrimaryAssets({ AssetId }, {}, GetDefault<UPeripheryMissionSettings>()->MissionLoadBundles);
+    }
+    else
+    {
+        Manager.UnloadPrimaryAsset(AssetId);
+    }
+}
+
+void UMissionSubsystem::HandOffPrefetch(FGameplayTag MissionID)
+{
+    // StartMission's load shares the Asset Manager's handle, which keeps the bundles loaded from here on
+    PrefetchHandles.Remove(MissionID);
+}
+
+void UMissionSubsystem::ReleaseAllPrefetches()
+{
+    TArray<FGameplayTag> Prefetched;
+    PrefetchHandles.GetKeys(Prefetched);
+    for (const FGameplayTag& MissionID : Prefetched)
+    {
+        ReleasePrefetch(MissionID);
+    }
+}
+
+// ---------- Event Bus ----------
+
+void UMissionSubsystem::EmitActorEvent(AActor* SourceActor, FGameplayTag EventTag)
+{
+    if (!EventTag.IsValid()) return;
+
+    // Objectives may not have their definitions yet while a save is restoring
+    if (!IsInGameThread() || bRestoringMissions || GetDefault<UPeripheryMissionSettings>()->bQueueMissionEvents)
+    {
+        EnqueueActorEvent(SourceActor, EventTag);
+        return;
+    }
+
+    FMissionEventRecord Record;
+    Record.EventTag = EventTag;
+    Record.SourceActor = SourceActor;
+    DispatchEventRecord(Record);
+}
+
+void UMissionSubsystem::EnqueueActorEvent(AActor* SourceActor, FGameplayTag EventTag)
+{
+    if (!EventTag.IsValid()) return;
+
+    FQueuedMissionEvents Queued;
+    FMissionEventRecord& Record = Queued.Records.AddDefaulted_GetRef();
+    Record.EventTag = EventTag;
+    Record.SourceActor = SourceActor;
+    IncomingEvents.Enqueue(MoveTemp(Queued));
+}
+
+void UMissionSubsystem::FlushQueuedEvents()
+{
+    check(IsInGameThread());
+    DrainQueuedEvents(TNumericLimits<double>::Max());
+}
+
+void UMissionSubsystem::DrainQueuedEvents(double BudgetSeconds)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UMissionSubsystem::DrainQueuedEvents);
+
+    // Held until the restored missions can consume them (FinishRestore)
+    if (bRestoringMissions) return;
+
+    const bool bCoalesce = GetDefault<UPeripheryMissionSettings>()->bCoalesceQueuedEvents;
+
+    // 1. Pull everything the producers have pushed so far
+    FQueuedMissionEvents Incoming;
+    while (IncomingEvents.Dequeue(Incoming))
+    {
+        if (bCoalesce && !Incoming.bBatch)
+        {
+            const FMissionEventRecord& Record = Incoming.Records[0];
+            const TPair<FGameplayTag, TWeakObjectPtr<AActor>> Key(Record.EventTag, Record.SourceActor);
+            if (const int32* Existing = PendingEventLookup.Find(Key))
+            {
+                PendingEvents[*Existing].Records[0].Count += Record.Count;
+                continue;
+            }
+            PendingEventLookup.Add(Key, PendingEvents.Num());
+        }
+        PendingEvents.Add(MoveTemp(Incoming));
+    }
+
+    // 2. Dispatch in arrival order until we run out of time (always make progress on at least one)
+    const double StartTime = FPlatformTime::Seconds();
+    while (PendingEventHead < PendingEvents.Num())
+    {
+        // Move out: dispatching can emit new events, which may grow PendingEvents during a flush
+        const FQueuedMissionEvents Queued = MoveTemp(PendingEvents[PendingEventHead]);
+        PendingEventHead++;
+
+        if (Queued.bBatch)
+        {
+            DispatchEventBatch(Queued.Records);
+        }
+        else
+        {
+            const FMissionEventRecord& Record = Queued.Records[0];
+            if (bCoalesce)
+            {
+                PendingEventLookup.Remove(TPair<FGameplayTag, TWeakObjectPtr<AActor>>(Record.EventTag, Record.SourceActor));
+            }
+            DispatchEventRecord(Record);
+        }
+
+        if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds) break;
+    }
+
+    // 3. Reset the staging buffer once it has been fully consumed
+    if (PendingEventHead >= PendingEvents.Num())
+    {
+        PendingEvents.Reset();
+        PendingEventLookup.Reset();
+        PendingEventHead = 0;
+    }
+}
+
+void UMissionSubsystem::EmitActorEvents(TArrayView<const FMissionEventRecord> Events)
+{
+    if (Events.Num() == 0) return;
+
+    if (!IsInGameThread() || bRestoringMissions || GetDefault<UPeripheryMissionSettings>()->bQueueMissionEvents)
+    {
+        // Kept together so the drain broadcasts it exactly like a direct call
+        FQueuedMissionEvents Queued;
+        Queued.bBatch = true;
+        for (const FMissionEventRecord& Record : Events)
+        {
+            if (Record.EventTag.IsValid() && Record.Count > 0) Queued.Records.Add(Record);
+        }
+        if (Queued.Records.Num() > 0) IncomingEvents.Enqueue(MoveTemp(Queued));
+        return;
+    }
+
+    DispatchEventBatch(Events);
+}
+
+void UMissionSubsystem::DispatchEventBatch(TArrayView<const FMissionEventRecord> Events)
+{
+    TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+    TRACE_CPUPROFILER_EVENT_SCOPE(UMissionSubsystem::DispatchEventBatch);
+
+    // 1. History for the whole batch, plus per-tag totals for the aggregated broadcast
+    TArray<FMissionEventRecord> Totals;
+    TMap<FGameplayTag, int32, TInlineSetAllocator<8>> TotalIndices;
+    for (const FMissionEventRecord& Record : Events)
+    {
+        if (!Record.EventTag.IsValid() || Record.Count <= 0) continue;
+
+        RecordEvent(Record.EventTag, Record.SourceActor.Get(), Record.Count);
+        RecordEventHistory(Record.SourceActor.Get(), Record.EventTag);
+
+        if (const int32* Index = TotalIndices.Find(Record.EventTag))
+        {
+            Totals[*Index].Count += Record.Count;
+        }
+        else
+        {
+            TotalIndices.Add(Record.EventTag, Totals.Num());
+            FMissionEventRecord& NewTotal = Totals.AddDefaulted_GetRef();
+            NewTotal.EventTag = Record.EventTag;
+            NewTotal.Count = Record.Count;
+        }
+    }
+    if (Totals.Num() == 0) return;
+
+    // 2. One broadcast for the batch (the per-event delegate fires once per distinct tag)
+    OnMissionEventBatchBroadcast.Broadcast(Totals);
+    for (const FMissionEventRecord& Total : Totals)
+    {
+        OnMissionEventBroadcast.Broadcast(Total.EventTag);
+    }
+
+    // 3. Objectives consume each record with its full count
+    for (const FMissionEventRecord& Record : Events)
+    {
+        if (!Record.EventTag.IsValid() || Record.Count <= 0) continue;
+        DeliverEvent(Record.EventTag, Record.SourceActor.Get(), Record.Count);
+    }
+}
+
+void UMissionSubsystem::EmitActorEventCount(FGameplayTag EventTag, int32 Count)
+{
+    FMissionEventRecord Record;
+    Record.EventTag = EventTag;
+    Record.Count = Count;
+    EmitActorEvents(MakeArrayView(&Record, 1));
+}
+
+void UMissionSubsystem::DispatchEventRecord(const FMissionEventRecord& Record)
+{
+    AActor* SourceActor = Record.SourceActor.Get();
+
+    RecordEvent(Record.EventTag, SourceActor, Record.Count);
+    TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+
+    RecordEventHistory(SourceActor, Record.EventTag);
+    OnMissionEventBroadcast.Broadcast(Record.EventTag);
+    DeliverEvent(Record.EventTag, SourceActor, Record.Count);
+}
+
+void UMissionSubsystem::RecordEventHistory(AActor* SourceActor, FGameplayTag EventTag)
+{
+    if (SourceActor)
+    {
+        EventHistory.Record(EventTag, GetSourceId(SourceActor));
+    }
+}
+
+void UMissionSubsystem::DeliverEvent(FGameplayTag EventTag, AActor* SourceActor, int32 Count)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UMissionSubsystem::DeliverEvent);
+#if COUNTERSTRACE_ENABLED
+    CountDeliveredEvent();
+#endif
+
+    // Collect listeners for the tag and its parents (objectives match hierarchically, 
+    // so a listener on "Enemy.Death" must also hear "Enemy.Death.Zombie").
+    // Copied up front because completing an objective edits the index mid-dispatch.
+    TArray<FObjectiveListener, TInlineAllocator<16>> Targets;
+    const TArray<FGameplayTag>& MatchChain = GetTagMatchChain(EventTag);
+    for (int32 Depth = 0; Depth < MatchChain.Num(); Depth++)
+    {
+        const TArray<FObjectiveListener>* Listeners = EventListeners.Find(MatchChain[Depth]);
+        if (!Listeners) continue;
+
+        for (const FObjectiveListener& Listener : *Listeners)
+        {
+            // Exact listeners only hear their own tag, which is always first in the chain
+            if (Depth > 0 && Listener.bExact) continue;
+
+            // An objective only lands here twice if it listens to a tag and one of its parents
+            if (Depth > 0 && Targets.Contains(Listener)) continue;
+            Targets.Add(Listener);
+        }
+    }
+
+    // Broadcaster: Send only to the objectives that can consume this event
+    for (const FObjectiveListener& Listener : Targets)
+    {
+        // Earlier listeners may have completed this objective or its whole mission
+        FObjectiveRuntimeState* ObjRt = GetObjectiveRuntime(Listener.MissionID, Listener.ObjectiveID);
+        if (!ObjRt || ObjRt->ObjectiveState != EProgressState::InProgress) continue;
+
+        // Pass to Router
+        ConsumeEventForObjective(Listener.MissionID, Listener.Objective, *ObjRt, EventTag, SourceActor, Count);
+    }
+}
+
+const TArray<FGameplayTag>& UMissionSubsystem::GetTagMatchChain(FGameplayTag EventTag)
+{
+    if (const TArray<FGameplayTag>* Cached = TagMatchChains.Find(EventTag))
+    {
+        return *Cached;
+    }
+
+    // GetGameplayTagParents lists the tag itself first, then its parents
+    TArray<FGameplayTag>& Chain = TagMatchChains.Add(EventTag);
+    EventTag.GetGameplayTagParents().GetGameplayTagArray(Chain);
+    return Chain;
+}
+
+void UMissionSubsystem::RegisterObjectiveListener(FGameplayTag MissionID, const UMissionData& MissionAsset, int32 ObjIndex)
+{
+    const FMissionRuntimeGraph& Graph = MissionAsset.GetRuntimeGraph();
+    const FMissionGraphNode* Node = Graph.GetNode(ObjIndex);
+    if (!Node) return;
+
+    const FObjectiveListener Listener{ MissionID, Node->ObjectiveID, MissionAsset.GetObjectiveAt(ObjIndex), Node->bListensExact };
+    for (const FGameplayTag& Tag : Graph.GetListenedTags(ObjIndex))
+    {
+        EventListeners.FindOrAdd(Tag).AddUnique(Listener);
+    }
+}
+
+void UMissionSubsystem::UnregisterObjectiveListener(FGameplayTag MissionID, const UMissionData& MissionAsset, int32 ObjIndex)
+{
+    const FMissionRuntimeGraph& Graph = MissionAsset.GetRuntimeGraph();
+    const FMissionGraphNode* Node = Graph.GetNode(ObjIndex);
+    if (!Node) return;
+
+    const FObjectiveListener Listener{ MissionID, Node->ObjectiveID };
+    for (const FGameplayTag& Tag : Graph.GetListenedTags(ObjIndex))
+    {
+        if (TArray<FObjectiveListener>* Listeners = EventListeners.Find(Tag))
+        {
+            Listeners->Remove(Listener);
+            if (Listeners->Num() == 0)
+            {
+                EventListeners.Remove(Tag);
+            }
+        }
+    }
+}
+
+void UMissionSubsystem::UnregisterMissionListeners(FGameplayTag MissionID)
+{
+    // Rare (mission end), so a full sweep is fine and doesn't depend on the asset still being loaded.
+    for (auto It = EventListeners.CreateIterator(); It; ++It)
+    {
+        It.Value().RemoveAll([MissionID](const FObjectiveListener& L) { return L.MissionID == MissionID; });
+        if (It.Value().Num() == 0)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UMissionSubsystem::RebuildEventListeners()
+{
+    EventListeners.Empty();
+
+    for (const TPair<FGameplayTag, FMissionRuntimeState>& MissionPair : ActiveMissions)
+    {
+        for (const TPair<FGameplayTag, FObjectiveRuntimeState>& ObjPair : MissionPair.Value.ActiveObjectives)
+        {
+            if (ObjPair.Value.ObjectiveState != EProgressState::InProgress) continue;
+
+            const UMissionData* MissionAsset = GetMissionAsset(MissionPair.Key);
+            const int32 ObjIndex = MissionAsset ? MissionAsset->FindObjectiveIndex(ObjPair.Key) : INDEX_NONE;
+            if (ObjIndex != INDEX_NONE)
+            {
+                RegisterObjectiveListener(MissionPair.Key, *MissionAsset, ObjIndex);
+            }
+        }
+    }
+}
+
+void UMissionSubsystem::ConsumeEventForObjective(FGameplayTag MissionID, const UMissionObjective* ObjDef, FObjectiveRuntimeState& ObjRt, FGameplayTag EventTag, AActor* SourceActor, int32 Count)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UMissionSubsystem::ConsumeEventForObjective);
+    TRACE_COUNTER_INCREMENT(MissionObjectivesTouched);
+    UE_LOG(LogPeripheryMission, Verbose, TEXT("MissionSubsystem: Attempt to Consume Event For Objective"));
+
+    const bool bChanged = (Count == 1) 
+        ? ObjDef->OnEvent(MissionID, EventTag, SourceActor, ObjRt)
+        : ObjDef->OnEventCount(MissionID, EventTag, SourceActor, Count, ObjRt);
+
+    if (bChanged)
+    {
+        UE_LOG(LogPeripheryMission, Verbose, TEXT("MissionSubsystem: Consuming Event For Objective"));
+        MarkMissionDirty(MissionID);
+        ResolveObjectiveOutcome(MissionID, ObjDef, ObjRt);
+    }
+}
+
+void UMissionSubsystem::ResolveObjectiveOutcome(FGameplayTag MissionID, const UMissionObjective* ObjDef, const FObjectiveRuntimeState& ObjRt)
+{
+    // "Did that break it?"
+    if (ObjDef->IsFailed(ObjRt))
+    {
+        CompleteObjective(MissionID, ObjDef->ObjectiveID, false);
+    }
+    // "Are you done?"
+    else if (ObjDef->IsComplete(ObjRt))
+    {
+        CompleteObjective(MissionID, ObjDef->ObjectiveID, true);
+    }
+}
+
+int32 UMissionSubsystem::GetEventCount(FGameplayTag EventTag)
+{
+    return EventHistory.GetEventCount(EventTag);
+}
+
+bool UMissionSubsystem::HasActorDoneEvent(AActor* Actor, FGameplayTag EventTag) 
+{
+    if (!Actor) return false;
+
+    return EventHistory.HasSourceDoneEvent(EventTag, GetSourceId(Actor));
+}
+
+FGuid UMissionSubsystem::ResolveSourceId(const AActor* Actor)
+{
+    if (!IsValid(Actor)) return FGuid();
+
+    const UGameInstance* GI = Actor->GetGameInstance();
+    if (UMissionSubsystem* MissionSys = GI ? GI->GetSubsystem<UMissionSubsystem>() : nullptr)
+    {
+        return MissionSys->GetSourceId(Actor);
+    }
+    return FGuid::NewDeterministicGuid(Actor->GetPathName());
+}
+
+FGuid UMissionSubsystem::GetSourceId(const AActor* Actor)
+{
+    if (!IsValid(Actor)) return FGuid();
+
+    if (const FGuid* Cached = SourceIdCache.Find(Actor))
+    {
+        return *Cached;
+    }
+
+    // Dead actors leave stale keys behind; start over rather than let the cache grow forever
+    if (SourceIdCache.Num() >= 4096)
+    {
+        SourceIdCache.Reset();
+    }
+
+    FGuid SourceId;
+    if (const UActorRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<UActorRegistrySubsystem>())
+    {
+        SourceId = Registry->GetGuidForActor(Actor);
+    }
+
+    // The path id isn't cached: the actor may register as saveable later, and from then on
+    // it must resolve to its registry Guid, the same as after a reload.
+    if (!SourceId.IsValid())
+    {
+        return FGuid::NewDeterministicGuid(Actor->GetPathName());
+    }
+
+    SourceIdCache.Add(Actor, SourceId);
+    return SourceId;
+}
+
+// ---------- Runtime getters ----------
+
+FMissionRuntimeState* UMissionSubsystem::GetActiveMissionRuntime(FGameplayTag MissionID)
+{
+	return MissionID.IsValid() ? ActiveMissions.Find(MissionID) : nullptr;
+}
+
+const FMissionRuntimeState* UMissionSubsystem::GetActiveMissionRuntime(FGameplayTag MissionID) const
+{
+	return MissionID.IsValid() ? ActiveMissions.Find(MissionID) : nullptr;
+}
+
+FObjectiveRuntimeState* UMissionSubsystem::GetObjectiveRuntime(FGameplayTag MissionID, FGameplayTag ObjectiveID)
+{
+	FMissionRuntimeState* MissionRt = GetActiveMissionRuntime(MissionID);
+	return (MissionRt && ObjectiveID.IsValid()) ? MissionRt->ActiveObjectives.Find(ObjectiveID) : nullptr;
+}
+
+const FObjectiveRuntimeState* UMissionSubsystem::GetObjectiveRuntime(FGameplayTag MissionID, FGameplayTag ObjectiveID) const
+{
+	const FMissionRuntimeState* MissionRt = GetActiveMissionRuntime(MissionID);
+	return (MissionRt && ObjectiveID.IsValid()) ? MissionRt->ActiveObjectives.Find(ObjectiveID) : nullptr;
+}
+
+
+// ---------- Actions ----------
+
+void UMissionSubsystem::RunActions(const TArray<TObjectPtr<UMissionAction>>& Actions, AActor* ContextActor)
+{
+    // The Actions contain their own logic, the executor only decides when each one runs
+    ActionExecutor.Run(Actions, MakeExecutionContext(ContextActor), GetDefault<UPeripheryMissionSettings>()->ActionBudgetMs / 1000.0);
+}
+
+FMissionExecutionContext UMissionSubsystem::MakeExecutionContext(AActor* ContextActor)
+{
+    FMissionExecutionContext Context;
+    Context.ContextActor = ContextActor;
+    Context.World = GetWorld();
+    Context.GameInstance = GetGameInstance();
+    Context.MissionSubsystem = this;
+    Context.Registry = Context.GameInstance ? Context.GameInstance->GetSubsystem<UActorRegistrySubsystem>() : nullptr;
+    Context.QueryCache = &ActionQueryCache;
+    return Context;
+}
+
+AActor* UMissionSubsystem::GetDefaultContextActor()
+{
+    // The pawn can change (possession, respawn) but not within a frame
+    if (DefaultContextFrame != GFrameCounter)
+    {
+        APlayerController* PC = GetGameInstance()->GetFirstLocalPlayerController();
+        DefaultContextActor = PC ? PC->GetPawn() : nullptr;
+        DefaultContextFrame = GFrameCounter;
+    }
+    return DefaultContextActor.Get();
+}
+
+
+// ---------- Save System ----------
+void UMissionSubsystem::SaveToGame(UPeripherySaveGame* SaveObject)
+{
+    if (!SaveObject) return;
+
+    // Don't leave progress sitting in the event queue
+    FlushQueuedEvents();
+
+    // 1. Active missions: serialize the ones that changed since the last save, reuse the rest
+    for (const TPair<FGameplayTag, FMissionRuntimeState>& Pair : ActiveMissions)
+    {
+        if (!MissionSaveCache.Contains(Pair.Key)) MarkMissionDirty(Pair.Key);
+    }
+    for (const FGameplayTag& MissionID : DirtyMissions)
+    {
+        if (const FMissionRuntimeState* MissionRt = ActiveMissions.Find(MissionID))
+        {
+            WriteMissionState(*MissionRt, MissionSaveCache.FindOrAdd(MissionID));
+        }
+        else
+        {
+            MissionSaveCache.Remove(MissionID);
+        }
+    }
+    const int32 NumWritten = DirtyMissions.Num();
+    DirtyMissions.Reset();
+
+    SaveObject->MissionSaveVersion = 1;
+    SaveObject->ActiveMissionRecords.Reset(MissionSaveCache.Num());
+    for (const TPair<FGameplayTag, TArray<uint8>>& Pair : MissionSaveCache)
+    {
+        FMissionSaveRecord& Record = SaveObject->ActiveMissionRecords.AddDefaulted_GetRef();
+        Record.MissionID = Pair.Key;
+        Record.StateData = Pair.Value;
+    }
+
+    // 2. Completed missions: append the ones finished since the last save
+    if (bCompletedArchiveStale)
+    {
+        CompletedArchive.Reset();
+        CompletedArchive.Add(CompletedArchiveVersion);
+        for (const TPair<FGameplayTag, FMissionRuntimeState>& Pair : CompletedMissions)
+        {
+            AppendCompletedMission(Pair.Key, Pair.Value, CompletedArchive);
+        }
+        bCompletedArchiveStale = false;
+    }
+    else
+    {
+        for (const FGameplayTag& MissionID : CompletedSinceSave)
+        {
+            if (const FMissionRuntimeState* Archived = CompletedMissions.Find(MissionID))
+            {
+                AppendCompletedMission(MissionID, *Archived, CompletedArchive);
+            }
+        }
+    }
+    CompletedSinceSave.Reset();
+    SaveObject->CompletedMissionsData = CompletedArchive;
+
+    SaveObject->ActiveMissions.Empty();
+    SaveObject->CompletedMissions.Empty();
+
+    // 3. Event history
+    EventHistory.SaveToBytes(SaveObject->EventHistoryData);
+    SaveObject->EventHistoryDB.Empty();
+
+    SaveObject->MissionTimers.Reset();
+    if (bRestoringMissions)
+    {
+        // Saved again before the last load finished, its timers haven't been scheduled yet
+        SaveObject->MissionTimers = PendingTimerRecords;
+    }
+    TimerWheel.ForEachTimer([SaveObject](FMissionTimerHandle, const FMissionTimerPayload& Payload, float RemainingSeconds)
+    {
+        FMissionTimerRecord& Record = SaveObject->MissionTimers.AddDefaulted_GetRef();
+        Record.Kind = (uint8)Payload.Kind;
+        Record.MissionID = Payload.MissionID;
+        Record.ObjectiveID = Payload.ObjectiveID;
+        Record.Action = FSoftObjectPath(Payload.Action.Get());
+        Record.RemainingSeconds = RemainingSeconds;
+    });
+    
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Data Saved to Object (%d of %d missions written)"), NumWritten, ActiveMissions.Num());
+}
+
+void UMissionSubsystem::LoadFromGame(const UPeripherySaveGame* SaveObject)
+{
+    if (!SaveObject) return;
+
+    if (IsRecording())
+    {
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: Loading a save while recording. The recording won't replay from a fresh state."));
+    }
+    TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+
+    // 1. Clear current state. Missions are kept aside: the ones the save has unchanged are reused as they are.
+    CancelRestore();
+    TMap<FGameplayTag, FMissionRuntimeState> PreviousMissions = MoveTemp(ActiveMissions);
+    ActiveMissions.Reset();
+    ReleaseAllPrefetches();
+    TimerWheel.Reset();
+    ActionExecutor.Reset();
+    ActionQueryCache.Reset();
+    DefaultContextFrame = MAX_uint64;
+    
+    // 2. Copy data back
+    if (SaveObject->MissionSaveVersion >= 1)
+    {
+        int32 NumReused = 0;
+        for (const FMissionSaveRecord& Record : SaveObject->ActiveMissionRecords)
+        {
+            // Same bytes as we last wrote, and not touched since
+            const TArray<uint8>* Cached = MissionSaveCache.Find(Record.MissionID);
+            FMissionRuntimeState* Previous = PreviousMissions.Find(Record.MissionID);
+            if (Previous && Cached && !DirtyMissions.Contains(Record.MissionID) && *Cached == Record.StateData)
+            {
+                ActiveMissions.Add(Record.MissionID, MoveTemp(*Previous));
+                NumReused++;
+                continue;
+            }
+
+            FMissionRuntimeState MissionRt;
+            if (!ReadMissionState(Record.StateData, MissionRt))
+            {
+                UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: Saved state of %s is corrupt. Mission dropped."), *Record.MissionID.ToString());
+                continue;
+            }
+            ActiveMissions.Add(Record.MissionID, MoveTemp(MissionRt));
+        }
+
+        // The cache now mirrors the save
+        MissionSaveCache.Reset();
+        DirtyMissions.Reset();
+        for (const FMissionSaveRecord& Record : SaveObject->ActiveMissionRecords)
+        {
+            if (ActiveMissions.Contains(Record.MissionID)) MissionSaveCache.Add(Record.MissionID, Record.StateData);
+        }
+
+        const bool bCompletedUnchanged = !bCompletedArchiveStale && CompletedSinceSave.Num() == 0 && CompletedArchive == SaveObject->CompletedMissionsData;
+        if (!bCompletedUnchanged)
+        {
+            CompletedMissions.Reset();
+            if (!ReadCompletedArchive(SaveObject->CompletedMissionsData, CompletedMissions))
+            {
+                UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: Completed mission archive is corrupt. Read %d missions."), CompletedMissions.Num());
+            }
+        }
+        CompletedArchive = SaveObject->CompletedMissionsData;
+        CompletedSinceSave.Reset();
+        bCompletedArchiveStale = false;
+
+        UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: %d of %d missions unchanged since the save, completed archive %s"),
+            NumReused, ActiveMissions.Num(), bCompletedUnchanged ? TEXT("unchanged") : TEXT("read"));
+    }
+    else
+    {
+        // Saves from before the delta format
+        ClearSaveCache();
+        CompletedMissions.Reset();
+        for (const TPair<FGameplayTag, FLegacyMissionRuntimeState>& Pair : SaveObject->ActiveMissions)
+        {
+            ActiveMissions.Add(Pair.Key, ImportLegacyMission(CopyTemp(Pair.Value)));
+        }
+        for (const TPair<FGameplayTag, FLegacyMissionRuntimeState>& Pair : SaveObject->CompletedMissions)
+        {
+            CompletedMissions.Add(Pair.Key, ImportLegacyMission(CopyTemp(Pair.Value)));
+        }
+    }
+    if (!EventHistory.LoadFromBytes(SaveObject->EventHistoryData))
+    {
+        UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: Event history blob is corrupt. History cleared."));
+    }
+    // Saves from before the compact format only have the name-keyed map
+    if (SaveObject->EventHistoryData.Num() == 0 && SaveObject->EventHistoryDB.Num() > 0)
+    {
+        EventHistory.ImportLegacy(SaveObject->EventHistoryDB);
+    }
+
+    // 3. Load every missing mission asset in one batch. Their objectives and actions are instanced
+    // subobjects, so they come with it; assets the actions reference load with MissionLoadBundles.
+    PendingTimerRecords = SaveObject->MissionTimers;
+    RestoreStartTime = FPlatformTime::Seconds();
+
+    UAssetManager& Manager = UAssetManager::Get();
+    TArray<FPrimaryAssetId> MissingAssets;
+    for (const TPair<FGameplayTag, FMissionRuntimeState>& Pair : ActiveMissions)
+    {
+        if (GetMissionAsset(Pair.Key)) continue;
+        MissingAssets.Add(FPrimaryAssetId(UMissionData::StaticClass()->GetFName(), Pair.Key.GetTagName()));
+    }
+
+    if (MissingAssets.Num() > 0)
+    {
+        bRestoringMissions = true;
+        RestoreSerial++;
+
+        FStreamableDelegate Delegate = FStreamableDelegate::CreateUObject(this, &UMissionSubsystem::OnRestoreAssetsLoaded, RestoreSerial);
+        RestoreHandle = Manager.LoadPrimaryAssets(MissingAssets, GetDefault<UPeripheryMissionSettings>()->MissionLoadBundles, Delegate);
+
+        // Still loading: FinishRestore runs from the callback
+        if (bRestoringMissions && RestoreHandle.IsValid() && !RestoreHandle->HasLoadCompleted())
+        {
+            UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Loading %d mission assets for the save"), MissingAssets.Num());
+            return;
+        }
+    }
+
+    // Everything was resident (or the load finished on the spot)
+    if (bRestoringMissions || MissingAssets.Num() == 0)
+    {
+        FinishRestore();
+    }
+}
+
+void UMissionSubsystem::ClearSaveCache()
+{
+    MissionSaveCache.Reset();
+    DirtyMissions.Reset();
+    CompletedArchive.Reset();
+    CompletedSinceSave.Reset();
+    bCompletedArchiveStale = true;
+}
+
+void UMissionSubsystem::OnRestoreAssetsLoaded(int32 Serial)
+{
+    // From a LoadFromGame / ResetSystem that has since been superseded
+    if (Serial != RestoreSerial || !bRestoringMissions) return;
+
+    FinishRestore();
+}
+
+FMissionRuntimeState UMissionSubsystem::ImportLegacyMission(FLegacyMissionRuntimeState&& Legacy)
+{
+    FMissionRuntimeState MissionRt;
+    MissionRt.MissionID = Legacy.MissionID;
+    MissionRt.MissionState = Legacy.MissionState;
+    MissionRt.CompletedObjectiveIDs = MoveTemp(Legacy.CompletedObjectiveIDs);
+    MissionRt.RemainingObjectives = Legacy.RemainingObjectives;
+    MissionRt.TotalObjectives = Legacy.TotalObjectives;
+
+    for (TPair<FGameplayTag, FLegacyObjectiveRuntimeState>& ObjPair : Legacy.ActiveObjectives)
+    {
+        MissionRt.ActiveObjectives.Add(ObjPair.Key, ObjPair.Value.ToRuntimeState());
+        if (ObjPair.Value.StorageVersion < ObjectiveStorageVersion::Latest)
+        {
+            PendingLegacyObjectives.Add(TPair<FGameplayTag, FGameplayTag>(Legacy.MissionID, ObjPair.Key), MoveTemp(ObjPair.Value));
+        }
+    }
+    return MissionRt;
+}
+
+void UMissionSubsystem::CancelRestore()
+{
+    bRestoringMissions = false;
+    RestoreSerial++;
+    PendingTimerRecords.Reset();
+    PendingLegacyObjectives.Reset();
+
+    if (RestoreHandle.IsValid())
+    {
+        RestoreHandle->CancelHandle();
+        RestoreHandle.Reset();
+    }
+}
+
+void UMissionSubsystem::FinishRestore()
+{
+    TGuardValue<int32> RecordingScope(RecordingDepth, RecordingDepth + 1);
+    bRestoringMissions = false;
+
+    // 4. Restore Asset Pointers
+    // The SaveFile knows the Tags ("Mission.ShiftStart") but it does NOT store the Asset Pointers.
+    for (auto& Pair : ActiveMissions)
+    {
+        FGameplayTag MissionID = Pair.Key;
+        const UMissionData* Asset = GetMissionAsset(MissionID); 
+        
+        if (Asset)
+        {
+            // Explicitly cache it to be safe
+            TrackResidentAsset(MissionID, const_cast<UMissionData*>(Asset));
+
+            // Older saves have no counter, and the asset may have changed since
+            const int32 SavedRemaining = Pair.Value.RemainingObjectives;
+            const int32 SavedTotal = Pair.Value.TotalObjectives;
+            InitializeCompletionCounter(Pair.Value, *Asset);
+            if (Pair.Value.RemainingObjectives != SavedRemaining || Pair.Value.TotalObjectives != SavedTotal)
+            {
+                MarkMissionDirty(MissionID);
+            }
+        }
+        else
+        {
+            UE_LOG(LogPeripheryMission, Error, TEXT("MissionSubsystem: Mission asset for %s could not be loaded"), *MissionID.ToString());
+        }
+    }
+
+    // Missions from the previous session are no longer pinned
+    EnforceResidencyBudget();
+
+    // 5. Bring objective storage up to the current schema / asset layout
+    for (auto& MissionPair : ActiveMissions)
+    {
+        for (auto& ObjPair : MissionPair.Value.ActiveObjectives)
+        {
+            const UMissionObjective* ObjDef = GetObjectiveFromAsset(MissionPair.Key, ObjPair.Key);
+            if (!ObjDef) continue;
+
+            FObjectiveRuntimeState& ObjRt = ObjPair.Value;
+            if (ObjRt.StorageVersion < ObjectiveStorageVersion::Latest)
+            {
+                UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Objective %s was saved with storage version %d. Migrating its progress."),
+                    *ObjPair.Key.ToString(), ObjRt.StorageVersion);
+
+                // Fresh slots, then carry over what the name-keyed maps had. Unique source history can't be
+                // carried over (it was keyed by actor name), so those counts stay but the sources may count again.
+                const EProgressState SavedState = ObjRt.ObjectiveState;
+                ObjDef->InitializeRuntime(ObjRt);
+                ObjRt.ObjectiveState = SavedState;
+                if (const FLegacyObjectiveRuntimeState* Legacy = PendingLegacyObjectives.Find(TPair<FGameplayTag, FGameplayTag>(MissionPair.Key, ObjPair.Key)))
+                {
+                    ObjDef->MigrateLegacyStorage(*Legacy, ObjRt);
+                }
+                MarkMissionDirty(MissionPair.Key);
+            }
+            else if (ObjRt.ConformStorage(ObjDef->GetStorageLayout()))
+            {
+                MarkMissionDirty(MissionPair.Key);
+            }
+        }
+    }
+
+    PendingLegacyObjectives.Reset();
+
+    // 6. Point the event bus at the restored objectives
+    RebuildEventListeners();
+
+    // 7. Restart saved timers with their remaining time
+    for (auto& MissionPair : ActiveMissions)
+    {
+        for (auto& ObjPair : MissionPair.Value.ActiveObjectives)
+        {
+            ObjPair.Value.DeadlineTimer.Invalidate();
+        }
+    }
+    for (const FMissionTimerRecord& Record : PendingTimerRecords)
+    {
+        FMissionTimerPayload Payload;
+        Payload.Kind = (EMissionTimerKind)Record.Kind;
+        Payload.MissionID = Record.MissionID;
+        Payload.ObjectiveID = Record.ObjectiveID;
+
+        if (Payload.Kind == EMissionTimerKind::DelayedAction)
+        {
+            Payload.Action = Cast<UMissionAction>(Record.Action.ResolveObject());
+            if (!Payload.Action.IsValid())
+            {
+                UE_LOG(LogPeripheryMission, Warning, TEXT("MissionSubsystem: Delayed action %s could not be restored"), *Record.Action.ToString());
+                continue;
+            }
+            TimerWheel.Schedule(Record.RemainingSeconds, Payload);
+        }
+        else if (FObjectiveRuntimeState* ObjRt = GetObjectiveRuntime(Record.MissionID, Record.ObjectiveID))
+        {
+            ObjRt->DeadlineTimer = TimerWheel.Schedule(Record.RemainingSeconds, Payload);
+        }
+    }
+
+    PendingTimerRecords.Reset();
+
+    // LoadedMissionAssets holds the missions now
+    RestoreHandle.Reset();
+
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Restored %d missions in %.1f ms"),
+        ActiveMissions.Num(), (FPlatformTime::Seconds() - RestoreStartTime) * 1000.0);
+    UE_LOG(LogPeripheryMission, Log, TEXT("MissionSubsystem: Data Loaded from Object"));
 }
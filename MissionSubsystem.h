@@ -5,14 +5,38 @@
 #include "GameplayTagContainer.h"
 #include "Missions/MissionStructs.h"
 #include "Missions/MissionData.h"
+#include "Missions/MissionEventHistory.h"
+#include "Missions/MissionEventRecorder.h"
+#include "Missions/MissionActionExecutor.h"
 #include "GameFramework/Actor.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "Containers/Queue.h"
+#include "Engine/StreamableManager.h"
 #include "MissionSubsystem.generated.h"
 
+// ====== Event Dispatch ======
+
+// An active objective registered in the event dispatch index.
+struct FObjectiveListener
+{
+	FGameplayTag MissionID;
+	FGameplayTag ObjectiveID;
+	const UMissionObjective* Objective = nullptr;
+
+	// Only hears the listened tag itself, not its children (see UMissionObjective::ListensExact)
+	bool bExact = false;
+
+	bool operator==(const FObjectiveListener& Other) const
+	{
+		return MissionID == Other.MissionID && ObjectiveID == Other.ObjectiveID;
+	}
+};
+
 // ====== Subsystem ======
 
 UCLASS(BlueprintType)
-class INSIDETFV03_API UMissionSubsystem : public UGameInstanceSubsystem
+class INSIDETFV03_API UMissionSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -44,6 +68,11 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FOnMissionEventBroadcast OnMissionEventBroadcast;
 
+	//On Bulk Event Broadcast (one entry per distinct tag, with the total count)
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMissionEventBatchBroadcast, const TArray<FMissionEventRecord>&, Events);
+	UPROPERTY(BlueprintAssignable)
+	FOnMissionEventBatchBroadcast OnMissionEventBatchBroadcast;
+
 public:
 
     UPROPERTY()
@@ -59,6 +88,15 @@ public:
 public:
 	
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject (drains the queued event bus, advances mission timers and pending actions)
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UMissionSubsystem, STATGROUP_Tickables); }
 
 	// Mission control
 	UFUNCTION(BlueprintCallable, Category="Mission")
@@ -70,6 +108,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mission")
 	bool IsMissionActive(FGameplayTag MissionID) const;
 
+	// Fraction of the mission's objectives that are done. 1 for finished missions, 0 for unknown ones.
+	UFUNCTION(BlueprintPure, Category="Mission")
+	float GetMissionProgress(FGameplayTag MissionID) const;
+
 
 	// Objective control
 	UFUNCTION(BlueprintCallable, Category="Objective")
@@ -83,9 +125,26 @@ public:
 
 
 	// Event bus
+	// Dispatches immediately, or queues when bQueueMissionEvents is set (or when called off the game thread).
 	UFUNCTION(BlueprintCallable, Category="Mission|Events")
 	void EmitActorEvent(AActor* SourceActor, FGameplayTag EventTag);
 
+	// Bulk emission: updates history and objectives in one pass and fires a single OnMissionEventBatchBroadcast.
+	// OnMissionEventBroadcast still fires, once per distinct tag in the batch.
+	// When the batch has to be queued it stays one unit, so the same delegates fire when it is drained.
+	void EmitActorEvents(TArrayView<const FMissionEventRecord> Events);
+
+	// The same (source-less) event happened Count times, e.g. a wave of identical kills.
+	UFUNCTION(BlueprintCallable, Category="Mission|Events")
+	void EmitActorEventCount(FGameplayTag EventTag, int32 Count);
+
+	// Thread-safe. Always queues; the event is dispatched during the next drain on the game thread.
+	void EnqueueActorEvent(AActor* SourceActor, FGameplayTag EventTag);
+
+	// Dispatches every queued event now, ignoring the frame budget.
+	UFUNCTION(BlueprintCallable, Category="Mission|Events")
+	void FlushQueuedEvents();
+
 	// Helper for Objectives to check history, returns the number of unique actors that have emitted given event.
     UFUNCTION(BlueprintCallable, Category="Mission|Events")
     int32 GetEventCount(FGameplayTag EventTag);
@@ -93,16 +152,64 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mission|Events")
 	bool HasActorDoneEvent(AActor* Actor, FGameplayTag EventTag);
 
+	// Stable identity for an event source: the Actor Registry save Guid if it has one,
+	// otherwise derived from the actor's path (stable for placed actors across level loads).
+	static FGuid ResolveSourceId(const AActor* Actor);
+	FGuid GetSourceId(const AActor* Actor);
+
 	// Save System
 	UFUNCTION(BlueprintCallable, Category = "SaveSystem")
 	void SaveToGame(UPeripherySaveGame* SaveObject);
 
+	// Mission assets that aren't resident are loaded in one batch. Until they arrive, events are queued and timers don't run.
 	UFUNCTION(BlueprintCallable, Category = "SaveSystem")
 	void LoadFromGame(const UPeripherySaveGame* SaveObject);
 
+	// True between LoadFromGame and its mission assets finishing loading
+	UFUNCTION(BlueprintPure, Category = "SaveSystem")
+	bool IsRestoringMissions() const { return bRestoringMissions; }
+
 	UFUNCTION(BlueprintCallable)
 	void ResetSystem();
 
+	// ---------- Timers ----------
+	// Runs Action after DelaySeconds of unpaused game time. Used by UAction_Delayed.
+	FMissionTimerHandle ScheduleDelayedAction(const UMissionAction* Action, AActor* ContextActor, float DelaySeconds);
+
+	// Seconds left on the objective's time limit, or -1 if it has none.
+	UFUNCTION(BlueprintPure, Category="Objective")
+	float GetObjectiveTimeRemaining(FGameplayTag MissionID, FGameplayTag ObjectiveID) const;
+
+	// ---------- Recording ----------
+	// Captures top-level mission calls and all events until StopRecording (Periphery.Mission.Record.Start / Stop).
+	void StartRecording();
+
+	// Writes the log with the current state appended, for UMissionReplayCommandlet to verify against.
+	bool StopRecording(const FString& FilePath);
+
+	bool IsRecording() const { return Recorder.IsValid(); }
+
+	// ---------- Residency ----------
+	// Makes a mission asset the Asset Manager doesn't know about (generated, transient) startable by ID.
+	void RegisterMissionAsset(UMissionData* MissionAsset);
+
+	int64 GetResidentMissionAssetBytes() const;
+
+	// Prints resident mission assets (Periphery.Mission.Residency)
+	void LogResidency() const;
+
+	// Runs the actions in order under the frame's action budget. Lists that don't fit, or wait on a latent action, continue on later ticks.
+	void RunActions(const TArray<TObjectPtr<UMissionAction>>& Actions, AActor* ContextActor);
+
+	// World, subsystems and the shared query cache, resolved for actions running against ContextActor
+	FMissionExecutionContext MakeExecutionContext(AActor* ContextActor);
+
+	// The local player's pawn, looked up once per frame. Context for actions that have none of their own.
+	AActor* GetDefaultContextActor();
+
+	// Prints per-class action cost (Periphery.Mission.ActionStats)
+	void LogActionStats() const { ActionExecutor.LogStats(); }
+
 protected:
 
 	// ---------- Missions ----------
@@ -114,23 +221,183 @@ protected:
 	// Callback function for Async Objective Loading
 	const UMissionData* GetMissionAsset(FGameplayTag MissionID) const;
 
+	// ---------- Prefetch ----------
+	// Starts loading MissionAsset's next mission once MissionRt is past the prefetch threshold.
+	void PrefetchNextMission(const FMissionRuntimeState& MissionRt, const UMissionData& MissionAsset);
+	void OnPrefetchLoaded(FGameplayTag NextMissionID);
+	// The next mission won't start from the prefetch: unloads what it loaded
+	void ReleasePrefetch(FGameplayTag NextMissionID);
+	// StartMission took over: stops tracking the prefetch without releasing anything
+	void HandOffPrefetch(FGameplayTag MissionID);
+	void ReleaseAllPrefetches();
+
+	// <Prefetched MissionID, the Asset Manager's handle for its bundles until StartMission takes over>
+	TMap<FGameplayTag, TSharedPtr<FStreamableHandle>> PrefetchHandles;
+
+	// ---------- Save cache ----------
+	// <Active MissionID, its state as last serialized>. Only dirty missions are serialized again on save.
+	TMap<FGameplayTag, TArray<uint8>> MissionSaveCache;
+	TSet<FGameplayTag> DirtyMissions;
+
+	// Completed missions as saved. New ones are appended; a full rebuild only follows Reset / Load.
+	TArray<uint8> CompletedArchive;
+	TArray<FGameplayTag> CompletedSinceSave;
+	bool bCompletedArchiveStale = true;
+
+	void MarkMissionDirty(FGameplayTag MissionID) { DirtyMissions.Add(MissionID); }
+	void ClearSaveCache();
+
+	// ---------- Save restore ----------
+	// Readiness barrier: set while LoadFromGame waits on mission assets
+	bool bRestoringMissions = false;
+
+	// Tells a stale load callback (from an earlier LoadFromGame) apart from the current one
+	int32 RestoreSerial = 0;
+
+	double RestoreStartTime = 0.0;
+	TSharedPtr<FStreamableHandle> RestoreHandle;
+
+	// Saved timers reference objectives and actions inside the mission assets, so they wait for the load too
+	TArray<FMissionTimerRecord> PendingTimerRecords;
+
+	// <Mission, Objective> name-keyed storage from an old save, migrated once the objective layouts are known
+	TMap<TPair<FGameplayTag, FGameplayTag>, FLegacyObjectiveRuntimeState> PendingLegacyObjectives;
+
+	// Old save format: objective storage waiting for migration goes to PendingLegacyObjectives
+	FMissionRuntimeState ImportLegacyMission(FLegacyMissionRuntimeState&& Legacy);
+
+	void OnRestoreAssetsLoaded(int32 Serial);
+
+	// Steps of LoadFromGame that need the mission assets
+	void FinishRestore();
+
+	void CancelRestore();
+
+	// ---------- Residency ----------
+	struct FMissionResidency
+	{
+		int64 SizeBytes = 0;
+		double LastUsedTime = 0.0;
+	};
+
+	// Adds the asset to LoadedMissionAssets and starts tracking its size / last use.
+	void TrackResidentAsset(FGameplayTag MissionID, UMissionData* MissionAsset);
+
+	// Unloads assets of missions that are not active, least recently used first, until under budget.
+	void EnforceResidencyBudget();
+
+	// Touched from const lookups
+	mutable TMap<FGameplayTag, FMissionResidency> ResidentMissionAssets;
+
 	// ---------- Objectives ----------
 	FObjectiveRuntimeState* GetObjectiveRuntime(FGameplayTag MissionID, FGameplayTag ObjectiveID);
 	const FObjectiveRuntimeState* GetObjectiveRuntime(FGameplayTag MissionID, FGameplayTag ObjectiveID) const;
 
 	const UMissionObjective* GetObjectiveFromAsset(FGameplayTag MissionID, FGameplayTag ObjectiveID) const;
-	void ActivateNextObjectives(FGameplayTag MissionID, const TArray<FGameplayTag>& NextObjectiveIDs);
+
+	// Sets TotalObjectives / RemainingObjectives from the asset and CompletedObjectiveIDs.
+	static void InitializeCompletionCounter(FMissionRuntimeState& MissionRt, const UMissionData& MissionAsset);
+
+	// One objective on CompleteObjective's stack
+	struct FCompletionFrame
+	{
+		FGameplayTag ObjectiveID;
+		bool bSuccess = true;
+		bool bStarted = false;
+
+		// Dependents already notified
+		int32 NextDependent = 0;
+	};
+
+	// Steps 1-2: validates the objective and marks it done. False if it can't be completed.
+	bool BeginObjectiveCompletion(FGameplayTag MissionID, FGameplayTag ObjectiveID, bool bSuccess);
+	// Step 3: notifies the frame's remaining dependents until one of them becomes complete
+	bool NotifyNextDependent(FGameplayTag MissionID, FCompletionFrame& Frame, FGameplayTag& OutUnlocked);
+	// Steps 4-5: actions, next objectives, mission completion
+	void FinishObjectiveCompletion(FGameplayTag MissionID, FGameplayTag ObjectiveID, bool bSuccess);
+	void ActivateNextObjectives(FGameplayTag MissionID, const UMissionData& MissionAsset, TArrayView<const int32> NextObjectiveIndices);
 
 	// ---------- Event Bus ----------
+	void DispatchEventRecord(const FMissionEventRecord& Record);
+	void DispatchEventBatch(TArrayView<const FMissionEventRecord> Events);
+	void RecordEventHistory(AActor* SourceActor, FGameplayTag EventTag);
+
+	// Routes an event (happening Count times) to the objectives listening for it or one of its parents.
+	void DeliverEvent(FGameplayTag EventTag, AActor* SourceActor, int32 Count);
+
+	// Moves events from the MPSC queue into PendingEvents (coalescing) and dispatches until the budget runs out.
+	void DrainQueuedEvents(double BudgetSeconds);
+
 	void ConsumeEventForObjective(FGameplayTag MissionID, const UMissionObjective* ObjDef,
-		 	FObjectiveRuntimeState& ObjRt, FGameplayTag EventTag, AActor* SourceActor);
+		 	FObjectiveRuntimeState& ObjRt, FGameplayTag EventTag, AActor* SourceActor, int32 Count = 1);
+
+	// Which sources have emitted which events, keyed by GetSourceId
+	FMissionEventHistory EventHistory;
 
-	// Map of <EventTag, Set of Actor Unique Names>
-	UPROPERTY(VisibleAnywhere, Category="Mission|Events")
-	TMap<FGameplayTag, FActorSet> EventHistoryDB;
+	// Registry Guids resolved by GetSourceId. Path-derived ids are never cached.
+	TMap<TWeakObjectPtr<const AActor>, FGuid> SourceIdCache;
+
+	// Dispatch index: <Listened EventTag, Active objectives that declared it>
+	TMap<FGameplayTag, TArray<FObjectiveListener>> EventListeners;
+
+	// <Event tag, the tag followed by its parents>. The tag tree is fixed at runtime, so entries never go stale.
+	TMap<FGameplayTag, TArray<FGameplayTag>> TagMatchChains;
+
+	const TArray<FGameplayTag>& GetTagMatchChain(FGameplayTag EventTag);
+
+	// Listened tags come from the asset's compiled graph (ObjIndex = node index)
+	void RegisterObjectiveListener(FGameplayTag MissionID, const UMissionData& MissionAsset, int32 ObjIndex);
+	void UnregisterObjectiveListener(FGameplayTag MissionID, const UMissionData& MissionAsset, int32 ObjIndex);
+	void UnregisterMissionListeners(FGameplayTag MissionID);
+	void RebuildEventListeners();
+
+	// One queued EmitActorEvent / EmitActorEvents call
+	struct FQueuedMissionEvents
+	{
+		TArray<FMissionEventRecord, TInlineAllocator<1>> Records;
+
+		// From EmitActorEvents: dispatched with DispatchEventBatch, never coalesced
+		bool bBatch = false;
+	};
+
+	// Producers (any thread) -> game thread
+	TQueue<FQueuedMissionEvents, EQueueMode::Mpsc> IncomingEvents;
+
+	// Game-thread staging for queued events. Entries before PendingEventHead are already dispatched.
+	TArray<FQueuedMissionEvents> PendingEvents;
+	int32 PendingEventHead = 0;
+
+	// <Tag + Source, index into PendingEvents> for single events not yet dispatched
+	TMap<TPair<FGameplayTag, TWeakObjectPtr<AActor>>, int32> PendingEventLookup;
 	
+	// ---------- Recording ----------
+	void RecordCall(EMissionRecordKind Kind, FGameplayTag PrimaryTag, FGameplayTag ObjectiveID = FGameplayTag(), bool bSuccess = true);
+	void RecordEvent(FGameplayTag EventTag, AActor* SourceActor, int32 Count);
+
+	TUniquePtr<FMissionEventRecorder> Recorder;
+
+	// > 0 while inside a mission call. Nested calls follow from the outer one, so they aren't recorded.
+	int32 RecordingDepth = 0;
+
+	// ---------- Timers ----------
+	FMissionTimerWheel TimerWheel;
+
+	// Reused between ticks
+	TArray<FMissionTimerHandle> ExpiredTimers;
+
+	void AdvanceTimers(float DeltaSeconds);
+
+	// Fails or completes the objective if its last event / timer decided it.
+	void ResolveObjectiveOutcome(FGameplayTag MissionID, const UMissionObjective* ObjDef, const FObjectiveRuntimeState& ObjRt);
+
 	// ---------- Actions ----------
-	void RunActions(const TArray<TObjectPtr<UMissionAction>>& Actions, AActor* ContextActor); 
+	FMissionActionExecutor ActionExecutor;
+
+	// Registry lookups shared by every action this frame
+	FMissionQueryCache ActionQueryCache;
+
+	TWeakObjectPtr<AActor> DefaultContextActor;
+	uint64 DefaultContextFrame = MAX_uint64;
 
 
 
@@ -0,0 +1,207 @@
+// Periphery -- EvEGames -- MissionTimerWheel.cpp
+
+#include "Missions/MissionTimerWheel.h"
+
+// ---------- Scheduling ----------
+
+FMissionTimerHandle FMissionTimerWheel::Schedule(float DelaySeconds, const FMissionTimerPayload& Payload)
+{
+    int32 NodeIndex;
+    if (FreeNodes.Num() > 0)
+    {
+        NodeIndex = FreeNodes.Pop();
+    }
+    else
+    {
+        NodeIndex = Nodes.AddDefaulted();
+    }
+
+    // Time already accumulated towards the next tick counts against the delay
+    const float Ticks = FMath::Max(DelaySeconds + Accumulator, 0.f) / TickSeconds;
+
+    FNode& Node = Nodes[NodeIndex];
+    Node.Payload = Payload;
+    Node.ExpiryTick = CurrentTick + FMath::Max<uint64>((uint64)FMath::CeilToDouble(Ticks), 1);
+    Node.bInUse = true;
+    Node.Serial++;
+    NumActive++;
+
+    Link(NodeIndex);
+
+    FMissionTimerHandle Handle;
+    Handle.Index = NodeIndex;
+    Handle.Serial = Node.Serial;
+    return Handle;
+}
+
+bool FMissionTimerWheel::Cancel(FMissionTimerHandle& Handle)
+{
+    const bool bLive = IsLive(Handle);
+    if (bLive)
+    {
+        Unlink(Handle.Index);
+        FreeNode(Handle.Index);
+    }
+    Handle.Invalidate();
+    return bLive;
+}
+
+bool FMissionTimerWheel::Consume(FMissionTimerHandle Handle, FMissionTimerPayload& OutPayload)
+{
+    if (!IsLive(Handle)) return false;
+
+    // Only expired timers (already off the wheel) can be consumed
+    FNode& Node = Nodes[Handle.Index];
+    if (Node.List != NoList) return false;
+
+    OutPayload = MoveTemp(Node.Payload);
+    FreeNode(Handle.Index);
+    return true;
+}
+
+float FMissionTimerWheel::GetRemainingSeconds(FMissionTimerHandle Handle) const
+{
+    if (!IsLive(Handle)) return -1.f;
+
+    const FNode& Node = Nodes[Handle.Index];
+    const uint64 TicksLeft = Node.ExpiryTick > CurrentTick ? Node.ExpiryTick - CurrentTick : 0;
+    return FMath::Max(TicksLeft * TickSeconds - Accumulator, 0.f);
+}
+
+void FMissionTimerWheel::ForEachTimer(TFunctionRef<void(FMissionTimerHandle, const FMissionTimerPayload&, float)> Visitor) const
+{
+    for (int32 i = 0; i < Nodes.Num(); i++)
+    {
+        if (!Nodes[i].bInUse) continue;
+
+        FMissionTimerHandle Handle;
+        Handle.Index = i;
+        Handle.Serial = Nodes[i].Serial;
+        Visitor(Handle, Nodes[i].Payload, GetRemainingSeconds(Handle));
+    }
+}
+
+void FMissionTimerWheel::Reset()
+{
+    Nodes.Reset();
+    FreeNodes.Reset();
+    for (int32& Head : ListHeads) Head = INDEX_NONE;
+
+    Accumulator = 0.f;
+    CurrentTick = 0;
+    NumActive = 0;
+}
+
+// ---------- Time ----------
+
+void FMissionTimerWheel::Advance(float DeltaSeconds, TArray<FMissionTimerHandle>& OutExpired)
+{
+    Accumulator += FMath::Max(DeltaSeconds, 0.f);
+    while (Accumulator >= TickSeconds)
+    {
+        Accumulator -= TickSeconds;
+        Step(OutExpired);
+    }
+}
+
+void FMissionTimerWheel::Step(TArray<FMissionTimerHandle>& OutExpired)
+{
+    CurrentTick++;
+
+    // 1. Whenever a level wraps, pull the next slot of the level above down (before expiring level 0)
+    int32 Level = 1;
+    for (; Level < NumLevels; Level++)
+    {
+        if ((CurrentTick & ((1ull << (SlotBits * Level)) - 1)) != 0) break;
+        Cascade(Level * NumSlots + (int32)((CurrentTick >> (SlotBits * Level)) & (NumSlots - 1)));
+    }
+    if (Level == NumLevels && (CurrentTick & ((1ull << (SlotBits * NumLevels)) - 1)) == 0)
+    {
+        Cascade(OverflowList);
+    }
+
+    // 2. Everything left in the current level 0 slot expires now
+    const int32 ListIndex = (int32)(CurrentTick & (NumSlots - 1));
+    while (ListHeads[ListIndex] != INDEX_NONE)
+    {
+        const int32 NodeIndex = ListHeads[ListIndex];
+        Unlink(NodeIndex);
+
+        FMissionTimerHandle Handle;
+        Handle.Index = NodeIndex;
+        Handle.Serial = Nodes[NodeIndex].Serial;
+        OutExpired.Add(Handle);
+    }
+}
+
+void FMissionTimerWheel::Cascade(int32 ListIndex)
+{
+    int32 NodeIndex = ListHeads[ListIndex];
+    ListHeads[ListIndex] = INDEX_NONE;
+
+    while (NodeIndex != INDEX_NONE)
+    {
+        const int32 Next = Nodes[NodeIndex].Next;
+        Nodes[NodeIndex].List = NoList;
+        Link(NodeIndex);
+        NodeIndex = Next;
+    }
+}
+
+// ---------- Lists ----------
+
+void FMissionTimerWheel::Link(int32 NodeIndex)
+{
+    FNode& Node = Nodes[NodeIndex];
+
+    // Lowest level whose slot for the expiry is less than a full turn away
+    int32 ListIndex = OverflowList;
+    for (int32 Level = 0; Level < NumLevels; Level++)
+    {
+        const int32 Shift = SlotBits * Level;
+        const uint64 Expiry = FMath::Max(Node.ExpiryTick, CurrentTick);
+        if ((Expiry >> Shift) - (CurrentTick >> Shift) < NumSlots)
+        {
+            ListIndex = Level * NumSlots + (int32)((Expiry >> Shift) & (NumSlots - 1));
+            break;
+        }
+    }
+
+    Node.List = ListIndex;
+    Node.Prev = INDEX_NONE;
+    Node.Next = ListHeads[ListIndex];
+    if (Node.Next != INDEX_NONE)
+    {
+        Nodes[Node.Next].Prev = NodeIndex;
+    }
+    ListHeads[ListIndex] = NodeIndex;
+}
+
+void FMissionTimerWheel::Unlink(int32 NodeIndex)
+{
+    FNode& Node = Nodes[NodeIndex];
+    if (Node.List == NoList) return;
+
+    if (Node.Prev != INDEX_NONE) Nodes[Node.Prev].Next = Node.Next;
+    else ListHeads[Node.List] = Node.Next;
+
+    if (Node.Next != INDEX_NONE) Nodes[Node.Next].Prev = Node.Prev;
+
+    Node.Prev = Node.Next = INDEX_NONE;
+    Node.List = NoList;
+}
+
+void FMissionTimerWheel::FreeNode(int32 NodeIndex)
+{
+    FNode& Node = Nodes[NodeIndex];
+    Node.bInUse = false;
+    Node.Payload = FMissionTimerPayload();
+    FreeNodes.Add(NodeIndex);
+    NumActive--;
+}
+
+bool FMissionTimerWheel::IsLive(FMissionTimerHandle Handle) const
+{
+    return Handle.IsValid() && Nodes.IsValidIndex(Handle.Index)
+        && Nodes[Handle.Index].bInUse && Nodes[Handle.Index].Serial == Handle.Serial;
+}
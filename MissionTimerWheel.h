@@ -0,0 +1,111 @@
+// Periphery -- EvEGames -- MissionTimerWheel.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UMissionAction;
+
+// Identifies a scheduled timer. Stale handles (fired / cancelled / slot reused) are rejected.
+struct FMissionTimerHandle
+{
+	uint32 Index = MAX_uint32;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != MAX_uint32; }
+	void Invalidate() { Index = MAX_uint32; }
+
+	bool operator==(const FMissionTimerHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+};
+
+enum class EMissionTimerKind : uint8
+{
+	ObjectiveDeadline,
+	DelayedAction
+};
+
+// What a timer does when it expires. Interpreted by UMissionSubsystem.
+struct FMissionTimerPayload
+{
+	EMissionTimerKind Kind = EMissionTimerKind::ObjectiveDeadline;
+
+	FGameplayTag MissionID;
+	FGameplayTag ObjectiveID;
+
+	// DelayedAction only
+	TWeakObjectPtr<const UMissionAction> Action;
+	TWeakObjectPtr<AActor> ContextActor;
+};
+
+/**
+ * Hierarchical timer wheel: 4 levels of 64 slots over fixed ticks, plus an overflow list.
+ * Schedule and Cancel are O(1); Advance costs O(1) per tick plus the timers it moves or fires.
+ */
+class INSIDETFV03_API FMissionTimerWheel
+{
+public:
+
+	explicit FMissionTimerWheel(float InTickSeconds = 0.05f) : TickSeconds(InTickSeconds) { Reset(); }
+
+	FMissionTimerHandle Schedule(float DelaySeconds, const FMissionTimerPayload& Payload);
+
+	// Returns false if the handle is stale.
+	bool Cancel(FMissionTimerHandle& Handle);
+
+	// Moves time forward. Expired timers are appended to OutExpired in expiry order; claim each with Consume.
+	void Advance(float DeltaSeconds, TArray<FMissionTimerHandle>& OutExpired);
+
+	// Frees an expired timer and returns its payload. False if it was cancelled in the meantime.
+	bool Consume(FMissionTimerHandle Handle, FMissionTimerPayload& OutPayload);
+
+	// Seconds until the timer fires, or -1 for stale handles.
+	float GetRemainingSeconds(FMissionTimerHandle Handle) const;
+
+	// Pending timers (scheduled, or expired and not yet consumed)
+	int32 Num() const { return NumActive; }
+
+	void ForEachTimer(TFunctionRef<void(FMissionTimerHandle, const FMissionTimerPayload&, float RemainingSeconds)> Visitor) const;
+
+	void Reset();
+
+private:
+
+	static constexpr int32 NumLevels = 4;
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr int32 OverflowList = NumLevels * NumSlots;
+	static constexpr int32 NoList = -1;
+
+	struct FNode
+	{
+		FMissionTimerPayload Payload;
+		uint64 ExpiryTick = 0;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 List = NoList;
+		uint32 Serial = 0;
+		bool bInUse = false;
+	};
+
+	bool IsLive(FMissionTimerHandle Handle) const;
+
+	void Link(int32 NodeIndex);
+	void Unlink(int32 NodeIndex);
+	void FreeNode(int32 NodeIndex);
+
+	// Re-files every node of a list relative to the current tick.
+	void Cascade(int32 ListIndex);
+	void Step(TArray<FMissionTimerHandle>& OutExpired);
+
+	float TickSeconds;
+	float Accumulator = 0.f;
+	uint64 CurrentTick = 0;
+	int32 NumActive = 0;
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+
+	// Heads of the per-slot lists, [Level * NumSlots + Slot], then the overflow list
+	int32 ListHeads[OverflowList + 1];
+};
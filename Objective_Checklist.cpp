@@ -2,10 +2,27 @@
 #include "Missions/Objectives/Objective_Checklist.h"
 #include "Subsystems/MissionSubsystem.h"
 
+void UObjective_Checklist::BuildStorageLayout()
+{
+    Super::BuildStorageLayout();
+    StorageLayout.NumFlags = RequiredTags.Num();
+}
+
+void UObjective_Checklist::MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const
+{
+    // Old key: the tag name
+    for (int32 i = 0; i < RequiredTags.Num(); i++)
+    {
+        if (Legacy.BoolStorage.FindRef(RequiredTags[i].GetTagName()))
+        {
+            RuntimeState.SetFlag(i);
+        }
+    }
+}
+
 void UObjective_Checklist::InitializeRuntime(FObjectiveRuntimeState& RuntimeState) const
 {
     Super::InitializeRuntime(RuntimeState);
-    RuntimeState.ObjectiveState = EProgressState::InProgress;
 
     if (bCountPastEvents)
     {
@@ -14,21 +31,15 @@ void UObjective_Checklist::InitializeRuntime(FObjectiveRuntimeState& RuntimeStat
         UMissionSubsystem* MissionSys = GetWorld()->GetGameInstance()->GetSubsystem<UMissionSubsystem>();
         if (MissionSys)
         {
-            for (const FGameplayTag& Tag : RequiredTags)
+            for (int32 i = 0; i < RequiredTags.Num(); i++)
             {
-                int32 EventCount = MissionSys->GetEventCount(Tag);
+                int32 EventCount = MissionSys->GetEventCount(RequiredTags[i]);
                 
                 // 4. Instant Completion Check
                 if (EventCount >= 1)
                 {
                     // 2. Mark this specific tag as done
-                    // Key: "TagName" -> true
-                    FName Key = Tag.GetTagName();
-                    
-                    if (!RuntimeState.BoolStorage.FindRef(Key))
-                    {
-                        RuntimeState.BoolStorage.Add(Key, true);
-                    }
+                    RuntimeState.SetFlag(i);
                 }
             }
         }
@@ -39,30 +50,35 @@ bool UObjective_Checklist::OnEvent(const FGameplayTag& MissionID, const FGamepla
         AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const
 {
     // 1. Is this event in our required list?
-    if (RequiredTags.Contains(EventTag))
+    bool bChanged = false;
+    for (int32 i = 0; i < RequiredTags.Num(); i++)
     {
         // 2. Mark this specific tag as done
-        // Key: "TagName" -> true
-        FName Key = EventTag.GetTagName();
-        
-        if (!RuntimeState.BoolStorage.FindRef(Key))
+        if (RequiredTags[i] == EventTag && RuntimeState.SetFlag(i))
         {
-            RuntimeState.BoolStorage.Add(Key, true);
-            return true; // State changed
+            bChanged = true; // State changed
         }
     }
-    return false;
+    return bChanged;
 }
 
 bool UObjective_Checklist::IsComplete(const FObjectiveRuntimeState& RuntimeState) const
 {
-    // Check if every required tag is marked true in storage
-    for (const FGameplayTag& Tag : RequiredTags)
+    // Check if every required tag is flagged in storage
+    for (int32 i = 0; i < RequiredTags.Num(); i++)
     {
-        if (!RuntimeState.BoolStorage.FindRef(Tag.GetTagName()))
+        if (!RuntimeState.GetFlag(i))
         {
             return false; // Found one missing
         }
     }
     return true;
+}
+
+void UObjective_Checklist::GetListenedEventTags(TArray<FGameplayTag>& OutTags) const
+{
+    for (const FGameplayTag& Tag : RequiredTags)
+    {
+        if (Tag.IsValid()) OutTags.AddUnique(Tag);
+    }
 }
\ No newline at end of file
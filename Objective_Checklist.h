@@ -22,4 +22,11 @@ public:
     virtual bool OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const override;
     
     virtual bool IsComplete(const FObjectiveRuntimeState& RuntimeState) const override;
+
+    virtual void GetListenedEventTags(TArray<FGameplayTag>& OutTags) const override;
+    virtual bool ListensExact() const override { return true; }
+
+    // Flag[i] = RequiredTags[i] seen
+    virtual void BuildStorageLayout() override;
+    virtual void MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const override;
 };
\ No newline at end of file
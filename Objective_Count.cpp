@@ -2,11 +2,28 @@
 #include "Missions/Objectives/Objective_Count.h"
 #include "Subsystems/MissionSubsystem.h"
 
+namespace
+{
+    constexpr int32 CountSlot = 0;
+}
+
+void UObjective_Count::BuildStorageLayout()
+{
+    Super::BuildStorageLayout();
+    StorageLayout.NumInts = 1;
+}
+
+void UObjective_Count::MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const
+{
+    if (const int32* Count = Legacy.IntStorage.Find("Count"))
+    {
+        RuntimeState.SetInt(CountSlot, *Count);
+    }
+}
 
 void UObjective_Count::InitializeRuntime(FObjectiveRuntimeState& RuntimeState) const
 {
     Super::InitializeRuntime(RuntimeState);
-    RuntimeState.ObjectiveState = EProgressState::InProgress;
 
     if (bCountPastEvents)
     {
@@ -19,7 +36,7 @@ void UObjective_Count::InitializeRuntime(FObjectiveRuntimeState& RuntimeState) c
         {
             int32 EventCount = MissionSys->GetEventCount(TargetEvent);
 
-            RuntimeState.IntStorage.Add("Count", EventCount);
+            RuntimeState.SetInt(CountSlot, EventCount);
             
             // 4. Instant Completion Check
             if (EventCount >= TargetCount)
@@ -34,26 +51,35 @@ void UObjective_Count::InitializeRuntime(FObjectiveRuntimeState& RuntimeState) c
 bool UObjective_Count::OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, 
     AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const 
 {
-    if (!EventTag.MatchesTag(TargetEvent)) return false;
+    return OnEventCount(MissionID, EventTag, SourceActor, 1, RuntimeState);
+}
+
+bool UObjective_Count::OnEventCount(const FGameplayTag& MissionID, const FGameplayTag& EventTag, 
+    AActor* SourceActor, int32 Count, FObjectiveRuntimeState& RuntimeState) const 
+{
+    if (Count <= 0 || !EventTag.MatchesTag(TargetEvent)) return false;
 
     // Unique Check
     if (bRequireUniqueSources && IsValid(SourceActor))
     {
-        FString ActorKey = SourceActor->GetName();
-        if (RuntimeState.StringStorage.Contains(ActorKey)) return false;
-        
-        RuntimeState.StringStorage.Add(ActorKey);
+        if (!RuntimeState.AddUniqueSource(CountSlot, UMissionSubsystem::ResolveSourceId(SourceActor))) return false;
+
+        // A single source only ever counts once
+        Count = 1;
     }
 
     // Increment
-    FName Key("Count");
-    int32 Val = RuntimeState.IntStorage.FindRef(Key);
-    RuntimeState.IntStorage.Add(Key, ++Val);
+    RuntimeState.AddInt(CountSlot, Count);
 
     return true;
 }
 
 bool UObjective_Count::IsComplete(const FObjectiveRuntimeState& RuntimeState) const 
 {
-    return RuntimeState.IntStorage.FindRef("Count") >= TargetCount;
+    return RuntimeState.GetInt(CountSlot) >= TargetCount;
+}
+
+void UObjective_Count::GetListenedEventTags(TArray<FGameplayTag>& OutTags) const
+{
+    if (TargetEvent.IsValid()) OutTags.Add(TargetEvent);
 }
\ No newline at end of file
@@ -30,8 +30,16 @@ public:
     virtual void InitializeRuntime(FObjectiveRuntimeState& RuntimeState) const override;
 
     virtual bool OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const override;
+
+    virtual bool OnEventCount(const FGameplayTag& MissionID, const FGameplayTag& EventTag, AActor* SourceActor, int32 Count, FObjectiveRuntimeState& RuntimeState) const override;
     
     virtual bool IsComplete(const FObjectiveRuntimeState& RuntimeState) const override;
 
+    virtual void GetListenedEventTags(TArray<FGameplayTag>& OutTags) const override;
+
+    // Int[0] = Count. Unique sources are tracked against slot 0.
+    virtual void BuildStorageLayout() override;
+    virtual void MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const override;
+
 };
    
\ No newline at end of file
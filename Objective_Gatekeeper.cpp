@@ -2,35 +2,51 @@
 
 #include "Missions/Objectives/Objective_Gatekeeper.h"
 
+void UObjective_Gatekeeper::BuildStorageLayout()
+{
+    Super::BuildStorageLayout();
+    StorageLayout.NumFlags = RequiredObjectives.Num();
+}
+
+void UObjective_Gatekeeper::MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const
+{
+    // Old key: the required objective's tag name
+    for (int32 i = 0; i < RequiredObjectives.Num(); i++)
+    {
+        if (Legacy.BoolStorage.FindRef(RequiredObjectives[i].GetTagName()))
+        {
+            RuntimeState.SetFlag(i);
+        }
+    }
+}
+
 bool UObjective_Gatekeeper::OnObjectiveCompleted(const FGameplayTag& CompletedObjectiveID, FObjectiveRuntimeState& RuntimeState) const
 {
     // Is the finished objective one of the ones we are waiting for?
-    if (RequiredObjectives.Contains(CompletedObjectiveID))
+    bool bChanged = false;
+    for (int32 i = 0; i < RequiredObjectives.Num(); i++)
     {
-        FName Key = CompletedObjectiveID.GetTagName();
-        
         // Mark it as done in our storage if it isn't already
-        if (!RuntimeState.BoolStorage.FindRef(Key))
+        if (RequiredObjectives[i] == CompletedObjectiveID && RuntimeState.SetFlag(i))
         {
-            RuntimeState.BoolStorage.Add(Key, true);
-            return true; // State changed! This prompts the Subsystem to check IsComplete().
+            bChanged = true; // State changed! This prompts the Subsystem to check IsComplete().
         }
     }
-    return false;
+    return bChanged;
 }
 
 bool UObjective_Gatekeeper::IsComplete(const FObjectiveRuntimeState& RuntimeState) const
 {
     // Iterate through our required list.
     // If ANY requirement is missing from storage, we are not done.
-    for (const FGameplayTag& Tag : RequiredObjectives)
+    for (int32 i = 0; i < RequiredObjectives.Num(); i++)
     {
-        if (!RuntimeState.BoolStorage.FindRef(Tag.GetTagName()))
+        if (!RuntimeState.GetFlag(i))
         {
             return false;
         }
     }
     
-    // All required tags were found in BoolStorage. We are done.
+    // All required flags are set. We are done.
     return true;
 }
\ No newline at end of file
@@ -20,9 +20,15 @@ public:
         AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const override { return false; }
 
     // --- 2. Listen for Objective Completion ---
-    // This is called by the Subsystem whenever ANY objective finishes.
+    // This is called by the Subsystem whenever one of the RequiredObjectives finishes.
     virtual bool OnObjectiveCompleted(const FGameplayTag& CompletedObjectiveID, FObjectiveRuntimeState& RuntimeState) const override;
 
+    virtual void GetRequiredObjectiveIDs(TArray<FGameplayTag>& OutIDs) const override { OutIDs.Append(RequiredObjectives); }
+
+    // Flag[i] = RequiredObjectives[i] completed
+    virtual void BuildStorageLayout() override;
+    virtual void MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const override;
+
 
     // --- 3. Check for Full Completion ---
     virtual bool IsComplete(const FObjectiveRuntimeState& RuntimeState) const override;
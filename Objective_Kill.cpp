@@ -1,12 +1,33 @@
 
 #include "Missions/Objectives/Objective_Kill.h"
 
+namespace
+{
+    constexpr int32 KillCountSlot = 0;
+}
+
+void UObjective_Kill::BuildStorageLayout()
+{
+    Super::BuildStorageLayout();
+    StorageLayout.NumInts = 1;
+}
+
+void UObjective_Kill::MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const
+{
+    RuntimeState.SetInt(KillCountSlot, Legacy.IntStorage.FindRef("KillCount"));
+}
 
 bool UObjective_Kill::OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, 
     AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const
+{
+    return OnEventCount(MissionID, EventTag, SourceActor, 1, RuntimeState);
+}
+
+bool UObjective_Kill::OnEventCount(const FGameplayTag& MissionID, const FGameplayTag& EventTag, 
+    AActor* SourceActor, int32 Count, FObjectiveRuntimeState& RuntimeState) const
 {
     // 1. Tag Check
-    if (!EventTag.MatchesTag(EnemyDeathTag)) return false;
+    if (Count <= 0 || !EventTag.MatchesTag(EnemyDeathTag)) return false;
 
     // 2. Source Check (The reason this class exists)
     if (bRequirePlayerSource)
@@ -20,15 +41,17 @@ bool UObjective_Kill::OnEvent(const FGameplayTag& MissionID, const FGameplayTag&
     }
 
     // 3. Increment (Same generic storage as Count)
-    FName Key("KillCount");
-    int32 CurrentKills = RuntimeState.IntStorage.FindRef(Key);
-    
-    RuntimeState.IntStorage.Add(Key, ++CurrentKills);
+    RuntimeState.AddInt(KillCountSlot, Count);
     
     return true;
 }
 
 bool UObjective_Kill::IsComplete(const FObjectiveRuntimeState& RuntimeState) const 
 {
-    return RuntimeState.IntStorage.FindRef("KillCount") >= RequiredKills;
+    return RuntimeState.GetInt(KillCountSlot) >= RequiredKills;
+}
+
+void UObjective_Kill::GetListenedEventTags(TArray<FGameplayTag>& OutTags) const
+{
+    if (EnemyDeathTag.IsValid()) OutTags.Add(EnemyDeathTag);
 }
\ No newline at end of file
@@ -19,7 +19,15 @@ public:
     bool bRequirePlayerSource = true;
 
     virtual bool OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const override;
+
+    virtual bool OnEventCount(const FGameplayTag& MissionID, const FGameplayTag& EventTag, AActor* SourceActor, int32 Count, FObjectiveRuntimeState& RuntimeState) const override;
     
     virtual bool IsComplete(const FObjectiveRuntimeState& RuntimeState) const override;
 
+    virtual void GetListenedEventTags(TArray<FGameplayTag>& OutTags) const override;
+
+    // Int[0] = KillCount
+    virtual void BuildStorageLayout() override;
+    virtual void MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const override;
+
 };
\ No newline at end of file
@@ -1,64 +1,90 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Missions/Objectives/Objective_Sequence.h"
+#include "Subsystems/MissionSubsystem.h"
+#include "Engine/GameInstance.h"
 
 
+namespace
+{
+    constexpr int32 StepIndexSlot = 0;
+}
+
+void UObjective_Sequence::BuildStorageLayout()
+{
+    Super::BuildStorageLayout();
+
+    // Slot 0 is the step index, requirement counters follow step by step
+    StepSlotOffsets.Reset(Steps.Num());
+    int32 NextSlot = StepIndexSlot + 1;
+    for (const FObjectiveStepDefinition& Step : Steps)
+    {
+        StepSlotOffsets.Add(NextSlot);
+        NextSlot += Step.RequiredEventsToCompleteStep.Num();
+    }
+    StorageLayout.NumInts = NextSlot;
+}
+
+void UObjective_Sequence::MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const
+{
+    RuntimeState.SetInt(StepIndexSlot, Legacy.IntStorage.FindRef("CurrentStepIndex"));
+
+    // Old counter key: "StepID_EventTag_Count"
+    for (int32 StepIndex = 0; StepIndex < Steps.Num() && StepSlotOffsets.IsValidIndex(StepIndex); StepIndex++)
+    {
+        const FObjectiveStepDefinition& Step = Steps[StepIndex];
+        for (int32 ReqIndex = 0; ReqIndex < Step.RequiredEventsToCompleteStep.Num(); ReqIndex++)
+        {
+            const FString CountKey = FString::Printf(TEXT("%s_%s_Count"),
+                *Step.StepID.ToString(),
+                *Step.RequiredEventsToCompleteStep[ReqIndex].RequiredEventTag.ToString());
+
+            RuntimeState.SetInt(StepSlotOffsets[StepIndex] + ReqIndex, Legacy.IntStorage.FindRef(FName(*CountKey)));
+        }
+    }
+}
+
 bool UObjective_Sequence::OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, 
     AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const 
 {
     // 1. Get Current Step Index (Default 0)
-    FName IndexKey("CurrentStepIndex");
-    int32 Index = RuntimeState.IntStorage.FindRef(IndexKey);
+    int32 Index = RuntimeState.GetInt(StepIndexSlot);
 
-    if (!Steps.IsValidIndex(Index)) return false;
+    if (!Steps.IsValidIndex(Index) || !StepSlotOffsets.IsValidIndex(Index)) return false;
 
     const FObjectiveStepDefinition& CurrentStep = Steps[Index];
+    const int32 FirstSlot = StepSlotOffsets[Index];
     bool bStepProgressed = false;
 
     // 2. Check Requirements for the CURRENT step only
-    for (const FStepRequirement& Req : CurrentStep.RequiredEventsToCompleteStep)
+    for (int32 ReqIndex = 0; ReqIndex < CurrentStep.RequiredEventsToCompleteStep.Num(); ReqIndex++)
     {
-        if (EventTag.MatchesTagExact(Req.RequiredEventTag))
+        const FStepRequirement& Req = CurrentStep.RequiredEventsToCompleteStep[ReqIndex];
+        if (!EventTag.MatchesTagExact(Req.RequiredEventTag)) continue;
+
+        const int32 CountSlot = FirstSlot + ReqIndex;
+
+        // -- Unique Source Logic --
+        if (Req.RequireUniqueSources && IsValid(SourceActor))
         {
-            // -- Unique Source Logic --
-            bool bUniqueSource = Req.RequireUniqueSources && IsValid(SourceActor);
-            if (bUniqueSource)
-            {
-                // Key: "StepID_Event_ActorName"
-                FString UniqueKey = FString::Printf(TEXT("%s_%s_%s"), 
-                    *CurrentStep.StepID.ToString(), 
-                    *Req.RequiredEventTag.ToString(), 
-                    *SourceActor->GetName());
-
-                if (RuntimeState.StringStorage.Contains(UniqueKey)) continue; // Already counted
-                
-                RuntimeState.StringStorage.Add(UniqueKey);
-            }
-
-            // -- Increment Counter --
-            // Key: "StepID_EventTag_Count"
-            FString CountKeyStr = FString::Printf(TEXT("%s_%s_Count"), 
-                *CurrentStep.StepID.ToString(), 
-                *Req.RequiredEventTag.ToString());
-            FName CountKey(*CountKeyStr);
-
-            int32 CurrentCount = RuntimeState.IntStorage.FindRef(CountKey);
-            RuntimeState.IntStorage.Add(CountKey, ++CurrentCount);
-            bStepProgressed = true;
+            // Already counted for this requirement
+            if (!RuntimeState.AddUniqueSource(CountSlot, UMissionSubsystem::ResolveSourceId(SourceActor))) continue;
         }
+
+        // -- Increment Counter --
+        RuntimeState.AddInt(CountSlot, 1);
+        bStepProgressed = true;
     }
 
+    // Counters moved even if the step isn't done, so report the change either way (the Subsystem saves on it)
     if (!bStepProgressed) return false;
 
     // 3. Check if Step is Complete
     bool bStepComplete = true;
-    for (const FStepRequirement& Req : CurrentStep.RequiredEventsToCompleteStep)
+    for (int32 ReqIndex = 0; ReqIndex < CurrentStep.RequiredEventsToCompleteStep.Num(); ReqIndex++)
     {
-        FString CountKeyStr = FString::Printf(TEXT("%s_%s_Count"), 
-            *CurrentStep.StepID.ToString(), 
-            *Req.RequiredEventTag.ToString());
-        
-        if (RuntimeState.IntStorage.FindRef(*CountKeyStr) < Req.NumberOfTimesEventMustOccur)
+        const FStepRequirement& Req = CurrentStep.RequiredEventsToCompleteStep[ReqIndex];
+        if (RuntimeState.GetInt(FirstSlot + ReqIndex) < Req.NumberOfTimesEventMustOccur)
         {
             bStepComplete = false;
             break;
@@ -70,35 +96,60 @@ bool UObjective_Sequence::OnEvent(const FGameplayTag& MissionID, const FGameplay
         // 1. Run Complete Actions for the OLD step
         RunStepActions(CurrentStep.StepCompleteActions, SourceActor);
 
-        // 2. Advance Index
+        // 2. Advance Index, and drop the finished step's unique sources (they can't matter anymore)
         int32 NextIndex = Index + 1;
-        RuntimeState.IntStorage.Add(IndexKey, NextIndex);
+        RuntimeState.SetInt(StepIndexSlot, NextIndex);
+
+        const int32 EndSlot = FirstSlot + CurrentStep.RequiredEventsToCompleteStep.Num();
+        RuntimeState.UniqueSources.RemoveAll([FirstSlot, EndSlot](const FObjectiveSourceEntry& Entry)
+        {
+            return Entry.Slot >= FirstSlot && Entry.Slot < EndSlot;
+        });
 
         // 3. Run Start Actions for the NEW step (if it exists)
         if (Steps.IsValidIndex(NextIndex))
         {
             RunStepActions(Steps[NextIndex].StepStartActions, SourceActor);
         }
-
-        return true; 
     }
-    return false;
+    return true;
 }
 
 
 bool UObjective_Sequence::IsComplete(const FObjectiveRuntimeState& RuntimeState) const 
 {
     // Done if Index has moved past the last step
-    int32 Index = RuntimeState.IntStorage.FindRef("CurrentStepIndex");
+    int32 Index = RuntimeState.GetInt(StepIndexSlot);
     return Index >= Steps.Num();
 }
 
 
+void UObjective_Sequence::GetListenedEventTags(TArray<FGameplayTag>& OutTags) const
+{
+    for (const FObjectiveStepDefinition& Step : Steps)
+    {
+        for (const FStepRequirement& Req : Step.RequiredEventsToCompleteStep)
+        {
+            if (Req.RequiredEventTag.IsValid()) OutTags.AddUnique(Req.RequiredEventTag);
+        }
+    }
+}
+
+
 void UObjective_Sequence::RunStepActions(const TArray<TObjectPtr<UMissionAction>>& Actions, AActor* Context) const
 {
+    // Same budget and latent handling as objective actions
+    const UGameInstance* GI = Context ? Context->GetGameInstance() : nullptr;
+    if (UMissionSubsystem* MissionSys = GI ? GI->GetSubsystem<UMissionSubsystem>() : nullptr)
+    {
+        MissionSys->RunActions(Actions, Context);
+        return;
+    }
+
+    const FMissionExecutionContext ExecutionContext = FMissionExecutionContext::FromActor(Context);
     for (const UMissionAction* Action : Actions)
     {
-        if (Action) Action->ExecuteAction(Context);
+        if (Action) Action->ExecuteAction(ExecutionContext);
     }
 }
 
@@ -55,9 +55,21 @@ public:
     
     virtual bool IsComplete(const FObjectiveRuntimeState& RuntimeState) const override;
 
+    // Listens for the requirements of every step, since the Subsystem only refreshes listeners on activation/completion.
+    virtual void GetListenedEventTags(TArray<FGameplayTag>& OutTags) const override;
+    virtual bool ListensExact() const override { return true; }
+
+    // Int[0] = CurrentStepIndex, then one counter per requirement of every step (see StepSlotOffsets).
+    // Unique sources are tracked against the requirement's counter slot.
+    virtual void BuildStorageLayout() override;
+    virtual void MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const override;
+
 private:
 
 void RunStepActions(const TArray<TObjectPtr<UMissionAction>>& Actions, AActor* Context) const;
 
+    // First counter slot of each step
+    TArray<int32> StepSlotOffsets;
+
 };
 
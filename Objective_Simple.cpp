@@ -2,10 +2,28 @@
 #include "Missions/Objectives/Objective_Simple.h"
 #include "Subsystems/MissionSubsystem.h"
 
+namespace
+{
+    constexpr int32 IsDoneFlag = 0;
+}
+
+void UObjective_Simple::BuildStorageLayout()
+{
+    Super::BuildStorageLayout();
+    StorageLayout.NumFlags = 1;
+}
+
+void UObjective_Simple::MigrateLegacyStorage(const FLegacyObjectiveRuntimeState& Legacy, FObjectiveRuntimeState& RuntimeState) const
+{
+    if (Legacy.BoolStorage.FindRef("IsDone"))
+    {
+        RuntimeState.SetFlag(IsDoneFlag);
+    }
+}
+
 void UObjective_Simple::InitializeRuntime(FObjectiveRuntimeState& RuntimeState) const
 {
     Super::InitializeRuntime(RuntimeState);
-    RuntimeState.ObjectiveState = EProgressState::InProgress;
 
     if (bCountPastEvents)
     {
@@ -32,7 +50,7 @@ bool UObjective_Simple::OnEvent(const FGameplayTag& MissionID, const FGameplayTa
 {
     if (EventTag.MatchesTag(TargetEvent))
     {
-        RuntimeState.BoolStorage.Add("IsDone", true);
+        RuntimeState.SetFlag(IsDoneFlag);
         return true;
     }
     return false;
@@ -40,5 +58,10 @@ bool UObjective_Simple::OnEvent(const FGameplayTag& MissionID, const FGameplayTa
 
 bool UObjective_Simple::IsComplete(const FObjectiveRuntimeState& RuntimeState) const
 {
-    return RuntimeState.BoolStorage.FindRef("IsDone");
+    return RuntimeState.GetFlag(IsDoneFlag);
+}
+
+void UObjective_Simple::GetListenedEventTags(TArray<FGameplayTag>& OutTags) const
+{
+    if (TargetEvent.IsValid()) OutTags.Add(TargetEvent);
 }
\ No newline at end of file
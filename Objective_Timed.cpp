@@ -0,0 +1,47 @@
+// Periphery -- EvEGames -- Objective_Timed.cpp
+#include "Missions/Objectives/Objective_Timed.h"
+
+namespace
+{
+    constexpr int32 TimeUpFlag = 0;
+    constexpr int32 EventSeenFlag = 1;
+}
+
+void UObjective_Timed::BuildStorageLayout()
+{
+    Super::BuildStorageLayout();
+    StorageLayout.NumFlags = 2;
+}
+
+bool UObjective_Timed::OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const
+{
+    if (RuntimeState.GetFlag(TimeUpFlag) || !EventTag.MatchesTag(TargetEvent)) return false;
+
+    return RuntimeState.SetFlag(EventSeenFlag);
+}
+
+bool UObjective_Timed::OnTimerExpired(const FGameplayTag& MissionID, FObjectiveRuntimeState& RuntimeState) const
+{
+    return RuntimeState.SetFlag(TimeUpFlag);
+}
+
+bool UObjective_Timed::IsComplete(const FObjectiveRuntimeState& RuntimeState) const
+{
+    const bool bTimeUp = RuntimeState.GetFlag(TimeUpFlag);
+    const bool bEventSeen = RuntimeState.GetFlag(EventSeenFlag);
+
+    return (Mode == ETimedObjectiveMode::Survive) ? (bTimeUp && !bEventSeen) : (bEventSeen && !bTimeUp);
+}
+
+bool UObjective_Timed::IsFailed(const FObjectiveRuntimeState& RuntimeState) const
+{
+    const bool bTimeUp = RuntimeState.GetFlag(TimeUpFlag);
+    const bool bEventSeen = RuntimeState.GetFlag(EventSeenFlag);
+
+    return (Mode == ETimedObjectiveMode::Survive) ? bEventSeen : (bTimeUp && !bEventSeen);
+}
+
+void UObjective_Timed::GetListenedEventTags(TArray<FGameplayTag>& OutTags) const
+{
+    if (TargetEvent.IsValid()) OutTags.Add(TargetEvent);
+}
@@ -0,0 +1,46 @@
+// Periphery -- EvEGames -- Objective_Timed.h
+#pragma once
+#include "CoreMinimal.h"
+#include "MissionObjective.h"
+#include "Objective_Timed.generated.h"
+
+UENUM(BlueprintType)
+enum class ETimedObjectiveMode : uint8
+{
+    // Completes when the time runs out. TargetEvent (optional) fails it before then.
+    Survive     UMETA(DisplayName = "Survive"),
+    // TargetEvent must happen before the time runs out, otherwise it fails.
+    Deadline    UMETA(DisplayName = "Deadline")
+};
+
+UCLASS(DisplayName = "Timed (Survive / Deadline)")
+class INSIDETFV03_API UObjective_Timed : public UMissionObjective
+{
+    GENERATED_BODY()
+
+public:
+
+    UPROPERTY(EditAnywhere, Category = "Rules")
+    ETimedObjectiveMode Mode = ETimedObjectiveMode::Survive;
+
+    UPROPERTY(EditAnywhere, Category = "Rules", meta = (ClampMin = "0.05", Units = "s"))
+    float Duration = 60.f;
+
+    UPROPERTY(EditAnywhere, Category = "Rules")
+    FGameplayTag TargetEvent;
+
+    virtual bool OnEvent(const FGameplayTag& MissionID, const FGameplayTag& EventTag, AActor* SourceActor, FObjectiveRuntimeState& RuntimeState) const override;
+
+    virtual bool OnTimerExpired(const FGameplayTag& MissionID, FObjectiveRuntimeState& RuntimeState) const override;
+
+    virtual float GetTimeLimit() const override { return Duration; }
+
+    virtual bool IsComplete(const FObjectiveRuntimeState& RuntimeState) const override;
+
+    virtual bool IsFailed(const FObjectiveRuntimeState& RuntimeState) const override;
+
+    virtual void GetListenedEventTags(TArray<FGameplayTag>& OutTags) const override;
+
+    // Flag[0] = TimeUp, Flag[1] = EventSeen
+    virtual void BuildStorageLayout() override;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "PeripheryMissionSettings.generated.h"
+
+/**
+ * Global Settings for the Mission System.
+ * Editable via Project Settings -> Game -> Periphery Mission Settings
+ */
+UCLASS(Config=Game, defaultconfig, meta=(DisplayName="Periphery Mission Settings"))
+class INSIDETFV03_API UPeripheryMissionSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    // --- Event Bus ---
+
+    // When true, EmitActorEvent only queues the event. The queue is drained once per frame by the Subsystem.
+    // Events emitted from worker threads are always queued.
+    UPROPERTY(Config, EditAnywhere, Category="Events")
+    bool bQueueMissionEvents = false;
+
+    // Time the Subsystem may spend draining queued events each frame. At least one event is always processed.
+    UPROPERTY(Config, EditAnywhere, Category="Events", meta=(ClampMin="0.0", Units="ms"))
+    float EventBudgetMs = 1.0f;
+
+    // Merge queued events with the same Tag + Source into one event carrying a repeat count.
+    UPROPERTY(Config, EditAnywhere, Category="Events")
+    bool bCoalesceQueuedEvents = true;
+
+    // --- Streaming ---
+
+    // Fraction of a mission's objectives that must be done before its NextMissionAsset starts loading in the background.
+    // At 1 the next mission is only loaded when it starts.
+    UPROPERTY(Config, EditAnywhere, Category="Streaming", meta=(ClampMin="0.0", ClampMax="1.0"))
+    float PrefetchProgressThreshold = 0.5f;
+
+    // Asset bundles loaded with a mission, both on prefetch and on StartMission.
+    // Tag soft references needed at mission start with meta=(AssetBundles="Start").
+    UPROPERTY(Config, EditAnywhere, Category="Streaming")
+    TArray<FName> MissionLoadBundles = { TEXT("Start") };
+
+    // Estimated memory mission assets may keep resident. Assets of completed missions are unloaded,
+    // least recently used first, until the total fits. Active missions are never unloaded.
+    UPROPERTY(Config, EditAnywhere, Category="Streaming", meta=(ClampMin="0", Units="KiB"))
+    int32 MissionAssetBudgetKB = 4096;
+
+    // Time per frame mission actions may take. Lists that run over continue next frame, so an objective's
+    // actions can then run after its next objectives have started. <= 0 (default) runs everything at once.
+    UPROPERTY(Config, EditAnywhere, Category="Actions", meta=(Units="ms"))
+    float ActionBudgetMs = 0.f;
+};
@@ -32,11 +32,23 @@ class INSIDETFV03_API UPeripherySaveGame : public USaveGame
 	public:
 
 	// --- Mission Data ---
+    // 0 = the two maps below, 1 = ActiveMissionRecords + CompletedMissionsData
     UPROPERTY(VisibleAnywhere, Category = "SaveData")
-    TMap<FGameplayTag, FMissionRuntimeState> ActiveMissions;
+    int32 MissionSaveVersion = 0;
 
     UPROPERTY(VisibleAnywhere, Category = "SaveData")
-    TMap<FGameplayTag, FMissionRuntimeState> CompletedMissions;
+    TArray<FMissionSaveRecord> ActiveMissionRecords;
+
+    // Packed archive of finished missions (see UMissionSubsystem::SaveToGame)
+    UPROPERTY(VisibleAnywhere, Category = "SaveData")
+    TArray<uint8> CompletedMissionsData;
+
+    // Legacy, only read when loading old saves
+    UPROPERTY(VisibleAnywhere, Category = "SaveData")
+    TMap<FGameplayTag, FLegacyMissionRuntimeState> ActiveMissions;
+
+    UPROPERTY(VisibleAnywhere, Category = "SaveData")
+    TMap<FGameplayTag, FLegacyMissionRuntimeState> CompletedMissions;
 
     // --- Player Data ---
     UPROPERTY(VisibleAnywhere, Category = "SaveData|Player")
@@ -49,6 +61,15 @@ class INSIDETFV03_API UPeripherySaveGame : public USaveGame
     UPROPERTY(VisibleAnywhere, Category = "SaveData|World")
     TArray<FName> ActiveDataLayers; 
 
+    // Packed FMissionEventHistory (see MissionEventHistory.h)
+    UPROPERTY(VisibleAnywhere, Category = "SaveData|World")
+    TArray<uint8> EventHistoryData;
+
+    // Objective time limits and delayed actions still running
+    UPROPERTY(VisibleAnywhere, Category = "SaveData|World")
+    TArray<FMissionTimerRecord> MissionTimers;
+
+    // Legacy name-keyed history, only read when loading old saves
     UPROPERTY(VisibleAnywhere, Category = "SaveData|World")
 	TMap<FGameplayTag, FActorSet> EventHistoryDB;
 
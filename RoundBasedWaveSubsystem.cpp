@@ -1,7 +1,9 @@
 // RoundBasedWaveSubsystem.cpp
 
 #include "Subsystems/RoundBasedWaveSubsystem.h"
+#include "Subsystems/ActorRegistrySubsystem.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "TimerManager.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
@@ -54,6 +56,15 @@ void URoundBasedWaveSubsystem::RegisterSpawner(AActor* Spawner)
 	}
 
 	Spawners.AddUnique(TWeakObjectPtr<AActor>(Spawner));
+
+	// Lets PickSpawner ask for spawners near the player
+	UGameInstance* GI = SpawnerTag.IsValid() ? GetWorld()->GetGameInstance() : nullptr;
+	if (UActorRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UActorRegistrySubsystem>() : nullptr)
+	{
+		Registry->RegisterActorForTag(Spawner, SpawnerTag);
+		Registry->RegisterSpatialActor(Spawner);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("Waves: Registered spawner %s. Total spawners: %d"),
 		*Spawner->GetName(), Spawners.Num());
 }
@@ -73,6 +84,12 @@ void URoundBasedWaveSubsystem::UnregisterSpawner(AActor* Spawner)
 		}
 	);
 
+	UGameInstance* GI = SpawnerTag.IsValid() ? GetWorld()->GetGameInstance() : nullptr;
+	if (UActorRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UActorRegistrySubsystem>() : nullptr)
+	{
+		Registry->UnregisterActorForTag(Spawner, SpawnerTag);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("Waves: Unregistered spawner %s. Removed %d. Remaining spawners: %d"),
 		*Spawner->GetName(), Removed, Spawners.Num());
 }
@@ -474,6 +491,28 @@ bool URoundBasedWaveSubsystem::PickEnemyOption(int32 RemainingTokens, FEnemyToke
 
 AActor* URoundBasedWaveSubsystem::PickSpawner() const
 {
+	// Prefer spawners around the player when configured
+	if (SpawnerTag.IsValid() && SpawnNearPlayerRadius > 0.f)
+	{
+		const UGameInstance* GI = GetWorld()->GetGameInstance();
+		const UActorRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UActorRegistrySubsystem>() : nullptr;
+		const APawn* Player = UGameplayStatics::GetPlayerPawn(this, 0);
+		if (Registry && Player)
+		{
+			TArray<AActor*, TInlineAllocator<16>> NearSpawners;
+			Registry->ForEachActorInRadius(FActorTagQuery().All(SpawnerTag), Player->GetActorLocation(), SpawnNearPlayerRadius,
+				[&NearSpawners](AActor* Spawner) { NearSpawners.Add(Spawner); return true; });
+
+			if (NearSpawners.Num() > 0)
+			{
+				AActor* Chosen = NearSpawners[FMath::RandRange(0, NearSpawners.Num() - 1)];
+				UE_LOG(LogTemp, Log, TEXT("Waves: PickSpawner - Chosen %s (%d within %.0f of player)"),
+					*Chosen->GetName(), NearSpawners.Num(), SpawnNearPlayerRadius);
+				return Chosen;
+			}
+		}
+	}
+
 	TArray<AActor*> ValidSpawners;
 	for (const TWeakObjectPtr<AActor>& Weak : Spawners)
 	{
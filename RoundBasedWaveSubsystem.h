@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
 #include "RoundBasedWaveSubsystem.generated.h"
 
 class AActor;
@@ -71,6 +72,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Waves|Config")
 	TArray<FEnemyTokenOption> EnemyOptions;
 
+	// Spawners are also filed in the Actor Registry (with position) under this tag. Unset = don't.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Waves|Config")
+	FGameplayTag SpawnerTag;
+
+	// > 0: pick among spawners within this distance of the player, if any (needs SpawnerTag). 0 = any spawner.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Waves|Config", meta=(ClampMin="0"))
+	float SpawnNearPlayerRadius = 0.f;
+
 	UFUNCTION(BlueprintCallable, Category="Waves|Config")
 	void SetWaveConfig(
 		int32 InFirstWaveTokens,